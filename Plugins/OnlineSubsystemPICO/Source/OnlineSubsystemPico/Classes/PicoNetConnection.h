@@ -19,6 +19,8 @@ class UPicoNetConnection : public UIpConnection
 private:
 	ppfID PeerID;
 	FString UserID;
+	/** Handle of UserID in the owning UPicoNetDriver's peer table */
+	int32 PeerHandle = INDEX_NONE;
 	/** Should this net connection behave as a passthrough to normal IP */
 	bool bIsPassThrough;
 
@@ -22,18 +22,47 @@ class UPicoNetDriver : public UIpNetDriver
 
 private:
 
+	/**
+	 * A remote platform user, interned once when it first shows up so the per-packet paths
+	 * never have to convert, hash or allocate its user ID again
+	 */
+	struct FPicoPeer
+	{
+		FString UserID;
+		/** Null-terminated UTF-8 copy of UserID, passed straight to ppf_Net_SendPacket */
+		TArray<ANSICHAR> UTF8UserID;
+		uint32 UTF8Hash;
+		/** Address handed to the stateless handshake; the handler sends its replies back to this same pointer */
+		TSharedPtr<FInternetAddr> Address;
+		UPicoNetConnection* Connection;
+		/** The server is expecting a handshake challenge from this peer */
+		bool bPendingChallenge;
+	};
+
 	bool AddNewClientConnection(const FString& UserID);
 	/** Should this net driver behave as a passthrough to normal IP */
 	bool bIsPassthrough;
 
-	// todo
-	//TMap<uint64, EConnectionState> PendingClientConnections;
-	TMap<FString, EConnectionState> PendingClientConnections;
+	/** Interned peers, indexed by peer handle. Entries live as long as the driver so handles stay valid */
+	TArray<FPicoPeer> Peers;
+
+	/** Session interface resolved once instead of on every send */
+	TWeakPtr<FOnlineSessionPico, ESPMode::ThreadSafe> CachedSessionInterface;
+
+	int32 FindPeer(const ANSICHAR* UTF8UserID) const;
+	int32 FindPeer(const FInternetAddr& Address) const;
+	bool IsSessionReady();
 
 public:
-	// todo
-	//TMap<uint64, UPicoNetConnection*> Connections;
-	TMap<FString, UPicoNetConnection*> Connections;
+
+	/** Returns the handle of the peer with this user ID, interning it on first use */
+	int32 InternPeer(const FString& UserID);
+
+	/** Null-terminated UTF-8 user ID of an interned peer, or nullptr for an invalid handle */
+	const ANSICHAR* GetPeerUTF8UserID(int32 PeerHandle) const
+	{
+		return Peers.IsValidIndex(PeerHandle) ? Peers[PeerHandle].UTF8UserID.GetData() : nullptr;
+	}
 
 	// Begin UNetDriver interface.
 	virtual bool IsAvailable() const override;
@@ -9,10 +9,30 @@
 #include "OnlineSessionSettings.h"
 #include "Pico_Leaderboard.h"
 #include "Misc/FileHelper.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queued leaderboard writes"), STAT_PicoOnline_LeaderboardQueueDepth, STATGROUP_PicoOnline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Leaderboard writes in flight"), STAT_PicoOnline_LeaderboardWritesInFlight, STATGROUP_PicoOnline);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Leaderboard writes per request"), STAT_PicoOnline_LeaderboardCoalescingRatio, STATGROUP_PicoOnline);
+
+static TAutoConsoleVariable<float> CVarPicoLeaderboardFlushInterval(
+	TEXT("pico.Online.LeaderboardFlushInterval"),
+	5.0f,
+	TEXT("Seconds between flushes of the queued leaderboard writes, writes to the same leaderboard in between are sent as one request. 0 flushes every tick."),
+	ECVF_Default);
 
 FOnlineLeaderboardPico::FOnlineLeaderboardPico(class FOnlineSubsystemPico& InSubsystem)
 	: PicoSubsystem(InSubsystem)
 {
+	OnEnterBackgroundHandle = FCoreDelegates::ApplicationWillEnterBackgroundDelegate.AddRaw(this, &FOnlineLeaderboardPico::OnApplicationWillPause);
+	OnDeactivateHandle = FCoreDelegates::ApplicationWillDeactivateDelegate.AddRaw(this, &FOnlineLeaderboardPico::OnApplicationWillPause);
+}
+
+FOnlineLeaderboardPico::~FOnlineLeaderboardPico()
+{
+	FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(OnEnterBackgroundHandle);
+	FCoreDelegates::ApplicationWillDeactivateDelegate.Remove(OnDeactivateHandle);
 }
 
 #if ENGINE_MAJOR_VERSION > 4
@@ -266,28 +286,7 @@ bool FOnlineLeaderboardPico::WriteLeaderboards(const FName& SessionName, const F
 	{
 		for (const auto& LeaderboardName : WriteObject.LeaderboardNames)
 		{
-			SaveLog(ELogVerbosity::Type::Log, FString::Printf(
-			TEXT("WriteLeaderboards WriteEntry LeaderboardName: %s, Score: %lld, UpdateMethod: %d, ForceUpdate: %s, WriteObject.RatedStat: %s")
-						, *LeaderboardName.ToString()
-						, Score
-						, WriteObject.UpdateMethod
-						, WriteObject.UpdateMethod == ELeaderboardUpdateMethod::Force ? TEXT("true") : TEXT("false")
-						, *WriteObject.RatedStat.ToString()
-			));
-		
-			PicoSubsystem.AddAsyncTask(
-				ppf_Leaderboard_WriteEntry(
-					TCHAR_TO_ANSI(*LeaderboardName.ToString()), Score, /* extra_data */ nullptr, 0,
-					(WriteObject.UpdateMethod == ELeaderboardUpdateMethod::Force)),
-				FPicoMessageOnCompleteDelegate::CreateLambda([this](ppfMessageHandle Message, bool bIsError)
-				{
-					if (bIsError)
-					{
-						auto Error = ppf_Message_GetError(Message);
-						auto ErrorMessage = ppf_Error_GetMessage(Error);
-						SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("WriteLeaderboards ErrorMessage: %s"), *FString(ErrorMessage)));
-					}
-				}));
+			QueueWrite(LeaderboardName.ToString(), Score, WriteObject.UpdateMethod, WriteObject.SortMethod);
 		}
 	}
 	else
@@ -302,36 +301,152 @@ bool FOnlineLeaderboardPico::WriteLeaderboards(const FName& SessionName, const F
 		SaveLog(ELogVerbosity::Type::Log, FString::Printf(TEXT("WriteLeaderboards begin WriteEntry PicoLeaderboardNames.Num(): %d"), PicoWriteObject->PicoLeaderboardNames.Num()));
 		for (const auto& LeaderboardName : PicoWriteObject->PicoLeaderboardNames)
 		{
-			SaveLog(ELogVerbosity::Type::Log, FString::Printf(
-			TEXT("WriteLeaderboards WriteEntry LeaderboardName: %s, Score: %lld, UpdateMethod: %d, ForceUpdate: %s, PicoWriteObject->RatedStat: %s")
-						, *LeaderboardName
-						, Score
-						, PicoWriteObject->UpdateMethod
-						, PicoWriteObject->UpdateMethod == ELeaderboardUpdateMethod::Force ? TEXT("true") : TEXT("false")
-						, *PicoWriteObject->RatedStat.ToString()
-			));
-		
-			PicoSubsystem.AddAsyncTask(
-				ppf_Leaderboard_WriteEntry(
-					TCHAR_TO_ANSI(*LeaderboardName), Score, /* extra_data */ nullptr, 0,
-					(PicoWriteObject->UpdateMethod == ELeaderboardUpdateMethod::Force)),
-				FPicoMessageOnCompleteDelegate::CreateLambda([this](ppfMessageHandle Message, bool bIsError)
-				{
-					if (bIsError)
-					{
-						auto Error = ppf_Message_GetError(Message);
-						auto ErrorMessage = ppf_Error_GetMessage(Error);
-						SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("WriteLeaderboards ErrorMessage: %s"), *FString(ErrorMessage)));
-					}
-				}));
+			QueueWrite(LeaderboardName, Score, PicoWriteObject->UpdateMethod, PicoWriteObject->SortMethod);
 		}
 	}
 	return true;
 };
 
+void FOnlineLeaderboardPico::QueueWrite(const FString& LeaderboardName, int64 Score, ELeaderboardUpdateMethod::Type UpdateMethod, ELeaderboardSort::Type SortMethod)
+{
+	const bool bForceUpdate = UpdateMethod == ELeaderboardUpdateMethod::Force;
+	FLeaderboardWriteSlot* Slot = WriteSlots.FindByPredicate([&LeaderboardName](const FLeaderboardWriteSlot& Candidate)
+	{
+		return Candidate.Name.Equals(LeaderboardName, ESearchCase::CaseSensitive);
+	});
+	if (!Slot)
+	{
+		Slot = &WriteSlots.AddDefaulted_GetRef();
+		Slot->Name = LeaderboardName;
+		auto AnsiName = StringCast<ANSICHAR>(*LeaderboardName);
+		Slot->AnsiName.Append(AnsiName.Get(), AnsiName.Length() + 1);
+	}
+
+	// The server applies queued writes one after the other. A forced write replaces whatever came before it, a regular
+	// write keeps the better of its score and the current one, so one request with the folded score ends the same way.
+	// The server owns the sort order, a regular write is only folded when the caller states it and it matches the
+	// pending write, otherwise the pending write is sent first so both reach the server.
+	const bool bKnownSort = SortMethod == ELeaderboardSort::Ascending || SortMethod == ELeaderboardSort::Descending;
+	if (Slot->bPending && !bForceUpdate && (!bKnownSort || SortMethod != Slot->SortMethod))
+	{
+		SendPendingWrite(*Slot);
+	}
+	if (!Slot->bPending || bForceUpdate)
+	{
+		Slot->Score = Score;
+		Slot->bForceUpdate = bForceUpdate;
+	}
+	else if (SortMethod == ELeaderboardSort::Ascending ? Score < Slot->Score : Score > Slot->Score)
+	{
+		Slot->Score = Score;
+	}
+	Slot->SortMethod = SortMethod;
+	Slot->NumWrites = Slot->bPending ? Slot->NumWrites + 1 : 1;
+	Slot->bPending = true;
+	UpdateWriteStats();
+}
+
+void FOnlineLeaderboardPico::TickPendingWrites(float DeltaTime)
+{
+	SecondsSinceFlush += DeltaTime;
+	if (SecondsSinceFlush >= CVarPicoLeaderboardFlushInterval.GetValueOnGameThread())
+	{
+		FlushPendingWrites();
+	}
+}
+
+void FOnlineLeaderboardPico::FlushPendingWrites()
+{
+	SecondsSinceFlush = 0.f;
+	for (FLeaderboardWriteSlot& Slot : WriteSlots)
+	{
+		if (Slot.bPending)
+		{
+			SendPendingWrite(Slot);
+		}
+	}
+	UpdateWriteStats();
+}
+
+void FOnlineLeaderboardPico::SendPendingWrite(FLeaderboardWriteSlot& Slot)
+{
+	SaveLog(ELogVerbosity::Type::Log, FString::Printf(TEXT("WriteLeaderboards WriteEntry LeaderboardName: %s, Score: %lld, ForceUpdate: %s, Writes: %d")
+		, *Slot.Name
+		, Slot.Score
+		, Slot.bForceUpdate ? TEXT("true") : TEXT("false")
+		, Slot.NumWrites));
+
+	PicoSubsystem.AddAsyncTask(
+		ppf_Leaderboard_WriteEntry(Slot.AnsiName.GetData(), Slot.Score, /* extra_data */ nullptr, 0, Slot.bForceUpdate),
+		FPicoMessageOnCompleteDelegate::CreateLambda([this](ppfMessageHandle Message, bool bIsError)
+		{
+			OnWriteEntryComplete(Message, bIsError);
+		}));
+	WriteStats.NumFlushedWrites += Slot.NumWrites;
+	WriteStats.NumRequests++;
+	WriteStats.NumInFlight++;
+	Slot.bPending = false;
+	Slot.NumWrites = 0;
+}
+
+void FOnlineLeaderboardPico::OnApplicationWillPause()
+{
+	// Shutdown rarely runs on Android once the app is in the background, send what is queued while it still can
+	FlushPendingWrites();
+}
+
+void FOnlineLeaderboardPico::OnWriteEntryComplete(ppfMessageHandle Message, bool bIsError)
+{
+	if (bIsError)
+	{
+		auto Error = ppf_Message_GetError(Message);
+		auto ErrorMessage = ppf_Error_GetMessage(Error);
+		SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("WriteLeaderboards ErrorMessage: %s"), *FString(ErrorMessage)));
+		bFlushFailed = true;
+	}
+	WriteStats.NumInFlight = FMath::Max(WriteStats.NumInFlight - 1, 0);
+	UpdateWriteStats();
+	if (WriteStats.NumInFlight == 0)
+	{
+		const bool bWasSuccessful = !bFlushFailed;
+		bFlushFailed = false;
+		// Delegates may flush again, which must not see the sessions being notified
+		TArray<FName> FlushedSessions = MoveTemp(PendingFlushSessions);
+		PendingFlushSessions.Reset();
+		for (const FName& SessionName : FlushedSessions)
+		{
+			TriggerOnLeaderboardFlushCompleteDelegates(SessionName, bWasSuccessful);
+		}
+	}
+}
+
+void FOnlineLeaderboardPico::UpdateWriteStats()
+{
+	int32 NumPending = 0;
+	for (const FLeaderboardWriteSlot& Slot : WriteSlots)
+	{
+		NumPending += Slot.bPending ? 1 : 0;
+	}
+	WriteStats.NumPending = NumPending;
+	SET_DWORD_STAT(STAT_PicoOnline_LeaderboardQueueDepth, WriteStats.NumPending);
+	SET_DWORD_STAT(STAT_PicoOnline_LeaderboardWritesInFlight, WriteStats.NumInFlight);
+	SET_FLOAT_STAT(STAT_PicoOnline_LeaderboardCoalescingRatio, WriteStats.GetCoalescingRatio());
+}
+
 bool FOnlineLeaderboardPico::FlushLeaderboards(const FName& SessionName)
 {
-	TriggerOnLeaderboardFlushCompleteDelegates(SessionName, true);
+	FlushPendingWrites();
+	SaveLog(ELogVerbosity::Type::Log, FString::Printf(TEXT("FlushLeaderboards requests in flight: %d, writes per request: %.2f")
+		, WriteStats.NumInFlight
+		, WriteStats.GetCoalescingRatio()));
+	if (WriteStats.NumInFlight == 0)
+	{
+		const bool bWasSuccessful = !bFlushFailed;
+		bFlushFailed = false;
+		TriggerOnLeaderboardFlushCompleteDelegates(SessionName, bWasSuccessful);
+		return true;
+	}
+	PendingFlushSessions.AddUnique(SessionName);
 	return true;
 };
 
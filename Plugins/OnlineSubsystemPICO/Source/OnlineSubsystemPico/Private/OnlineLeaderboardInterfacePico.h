@@ -24,6 +24,25 @@
   */
 
 
+/** Counters of the leaderboard write queue */
+struct FPicoLeaderboardWriteStats
+{
+    /** Leaderboards with a write waiting for the next flush */
+    int32 NumPending = 0;
+    /** Write requests sent and not completed yet */
+    int32 NumInFlight = 0;
+    /** Leaderboard entries passed to WriteLeaderboards and flushed since startup */
+    uint64 NumFlushedWrites = 0;
+    /** ppf_Leaderboard_WriteEntry requests sent for them */
+    uint64 NumRequests = 0;
+
+    /** Writes per request, 1 when nothing was coalesced */
+    float GetCoalescingRatio() const
+    {
+        return NumRequests > 0 ? (float)((double)NumFlushedWrites / NumRequests) : 1.f;
+    }
+};
+
   /**
   *	IOnlineLeaderboard - Interface class for Leaderboard
   */
@@ -42,14 +61,42 @@ private:
 
     static void SaveLog(const ELogVerbosity::Type Verbosity, const FString& Log);
 
+    /** Latest state of one leaderboard in the write queue, kept after flushing so its name is only converted once */
+    struct FLeaderboardWriteSlot
+    {
+        FString Name;
+        /** Null-terminated ANSI copy of Name, passed to ppf_Leaderboard_WriteEntry */
+        TArray<ANSICHAR> AnsiName;
+        bool bPending = false;
+        int64 Score = 0;
+        bool bForceUpdate = false;
+        ELeaderboardSort::Type SortMethod = ELeaderboardSort::Descending;
+        /** Writes folded into the pending one */
+        int32 NumWrites = 0;
+    };
+
+    void QueueWrite(const FString& LeaderboardName, int64 Score, ELeaderboardUpdateMethod::Type UpdateMethod, ELeaderboardSort::Type SortMethod);
+    void SendPendingWrite(FLeaderboardWriteSlot& Slot);
+    void OnApplicationWillPause();
+    void OnWriteEntryComplete(ppfMessageHandle Message, bool bIsError);
+    void UpdateWriteStats();
+
+    TArray<FLeaderboardWriteSlot> WriteSlots;
+    FPicoLeaderboardWriteStats WriteStats;
+    float SecondsSinceFlush = 0.f;
+    /** Sessions passed to FlushLeaderboards, notified once the writes in flight complete */
+    TArray<FName> PendingFlushSessions;
+    bool bFlushFailed = false;
+    FDelegateHandle OnEnterBackgroundHandle;
+    FDelegateHandle OnDeactivateHandle;
+
 public:
 
 
     //Constructor * @param InSubsystem - A reference to the owning subsystem
     FOnlineLeaderboardPico(FOnlineSubsystemPico& InSubsystem);
 
-    // Default destructor
-    virtual ~FOnlineLeaderboardPico() = default;
+    virtual ~FOnlineLeaderboardPico();
 
     // Begin IOnlineLeaderboard interface
 
@@ -96,6 +143,10 @@ public:
     virtual void FreeStats(FOnlineLeaderboardRead& ReadObject) override;
 
     /// <summary>Writes an entry to a leaderboard for the current logged-in user.</summary>
+    /// The entry is queued and sent on the next flush, see `pico.Online.LeaderboardFlushInterval`.
+    /// Writes to the same leaderboard before then are coalesced into one request: a forced write keeps the latest score,
+    /// otherwise the best score by the write object's `SortMethod` is kept. Regular writes without an `Ascending` or
+    /// `Descending` sort method are not coalesced. The queue is also flushed when the app goes to the background.
     ///
     /// <param name="SessionName">not used</param>
     /// <param name="Player">The ID of the current logged-in user to write an entry for.</param>
@@ -108,7 +159,9 @@ public:
     /// </returns>
     virtual bool WriteLeaderboards(const FName& SessionName, const FUniqueNetId& Player, FOnlineLeaderboardWrite& WriteObject) override;
 
-    /// <summary>Executes developer-defined functions.</summary>
+    /// <summary>Sends the queued leaderboard writes now.</summary>
+    /// `LeaderboardFlushCompleteDelegates` is triggered once every write sent so far has completed,
+    /// with `false` if any of them failed.
     ///
     /// <param name="SessionName">The parameter of `LeaderboardFlushCompleteDelegates`.</param>
     /// <returns>Bool: 
@@ -122,6 +175,14 @@ public:
     // Not supported. Always return false.
     virtual bool WriteOnlinePlayerRatings(const FName& SessionName, int32 LeaderboardId, const TArray<FOnlinePlayerScore>& PlayerScores) override;
     // End IOnlineLeaderboard interface
+
+    /** Flushes the write queue when the flush interval has passed */
+    void TickPendingWrites(float DeltaTime);
+
+    /** Sends one request per leaderboard with a queued write */
+    void FlushPendingWrites();
+
+    const FPicoLeaderboardWriteStats& GetWriteStats() const { return WriteStats; }
 };
 #if ENGINE_MINOR_VERSION > 26
 typedef TSharedPtr<FOnlineLeaderboardPico, ESPMode::ThreadSafe> FOnlineLeaderboardPicoPtr;
@@ -6,6 +6,29 @@
 #include "OnlineMessageTaskManagerPico.h"
 #include "OnlineSubsystemPicoPrivate.h"
 #include "PPF_Message.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Message pump"), STAT_PicoOnline_MessagePump, STATGROUP_PicoOnline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Messages dispatched"), STAT_PicoOnline_MessagesDispatched, STATGROUP_PicoOnline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending realtime messages"), STAT_PicoOnline_PendingRealtime, STATGROUP_PicoOnline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending default messages"), STAT_PicoOnline_PendingDefault, STATGROUP_PicoOnline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending bulk messages"), STAT_PicoOnline_PendingBulk, STATGROUP_PicoOnline);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Oldest dispatched message age (ms)"), STAT_PicoOnline_MaxMessageAgeMs, STATGROUP_PicoOnline);
+
+static TAutoConsoleVariable<int32> CVarPicoMaxMessagesPerTick(
+    TEXT("pico.Online.MaxMessagesPerTick"),
+    64,
+    TEXT("Maximum number of platform messages dispatched per tick, 0 for no limit."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPicoMessageBudgetMs(
+    TEXT("pico.Online.MessageBudgetMs"),
+    2.0f,
+    TEXT("Time budget in milliseconds for dispatching platform messages per tick, 0 for no limit. At least one message is dispatched per tick."),
+    ECVF_Default);
+
+// Upper bound on messages popped per tick, so a producer outpacing the pump cannot keep it popping forever
+static const int32 PicoMaxMessagePopsPerTick = 1024;
 
 FString FOnlineAsyncTaskPico::ToString() const
 {
@@ -81,42 +104,162 @@ void FOnlineAsyncTaskManagerPico::OnlineTick()
 {
 }
 
+FOnlineAsyncTaskManagerPico::~FOnlineAsyncTaskManagerPico()
+{
+    for (TArray<FPendingMessage>& LaneMessages : PendingMessages)
+    {
+        for (const FPendingMessage& PendingMessage : LaneMessages)
+        {
+            ppf_FreeMessage(PendingMessage.MessageHandle);
+        }
+    }
+}
+
+FOnlineAsyncTaskManagerPico::EMessageLane FOnlineAsyncTaskManagerPico::GetMessageLane(ppfMessageType MessageType)
+{
+    // Only the RTC notifications jump ahead. Room, matchmaking and game notifications stay in the Default lane, in
+    // FIFO order with the request responses that set up the session state they update
+    switch (MessageType)
+    {
+    case ppfMessageType_Notification_Rtc_OnRoomStats:
+    case ppfMessageType_Notification_Rtc_OnJoinRoom:
+    case ppfMessageType_Notification_Rtc_OnLeaveRoom:
+    case ppfMessageType_Notification_Rtc_OnUserLeaveRoom:
+    case ppfMessageType_Notification_Rtc_OnUserJoinRoom:
+    case ppfMessageType_Notification_Rtc_OnConnectionStateChange:
+    case ppfMessageType_Notification_Rtc_OnWarn:
+    case ppfMessageType_Notification_Rtc_OnRoomWarn:
+    case ppfMessageType_Notification_Rtc_OnRoomError:
+    case ppfMessageType_Notification_Rtc_OnError:
+    case ppfMessageType_Notification_Rtc_OnUserStartAudioCapture:
+    case ppfMessageType_Notification_Rtc_OnAudioPlaybackDeviceChanged:
+    case ppfMessageType_Notification_Rtc_OnRemoteAudioPropertiesReport:
+    case ppfMessageType_Notification_Rtc_OnLocalAudioPropertiesReport:
+    case ppfMessageType_Notification_Rtc_OnUserStopAudioCapture:
+    case ppfMessageType_Notification_Rtc_OnUserMuteAudio:
+    case ppfMessageType_Notification_Rtc_OnMediaDeviceStateChanged:
+    case ppfMessageType_Notification_Rtc_OnRoomMessageReceived:
+    case ppfMessageType_Notification_Rtc_OnUserMessageReceived:
+    case ppfMessageType_Notification_Rtc_OnTokenWillExpire:
+    case ppfMessageType_Notification_Rtc_OnStreamSyncInfoReceived:
+    case ppfMessageType_Notification_Rtc_OnVideoDeviceStateChanged:
+    case ppfMessageType_Notification_Rtc_OnFirstLocalVideoFrameCaptured:
+    case ppfMessageType_Notification_Rtc_OnRoomBinaryMessageReceived:
+    case ppfMessageType_Notification_Rtc_OnLocalVideoSizeChanged:
+    case ppfMessageType_Notification_Rtc_OnScreenVideoFrameSendStateChanged:
+    case ppfMessageType_Notification_Rtc_OnUserBinaryMessageReceived:
+    case ppfMessageType_Notification_Rtc_OnLocalVideoStateChanged:
+    case ppfMessageType_Notification_Rtc_OnUserMessageSendResult:
+    case ppfMessageType_Notification_Rtc_OnUserUnPublishScreen:
+    case ppfMessageType_Notification_Rtc_OnRoomMessageSendResult:
+    case ppfMessageType_Notification_Rtc_OnUserPublishStream:
+    case ppfMessageType_Notification_Rtc_OnUserUnPublishStream:
+    case ppfMessageType_Notification_Rtc_OnUserPublishScreen:
+        return EMessageLane::Realtime;
+    case ppfMessageType_Leaderboard_Get:
+    case ppfMessageType_Leaderboard_GetNextLeaderboardArrayPage:
+    case ppfMessageType_Leaderboard_GetEntries:
+    case ppfMessageType_Leaderboard_GetEntriesAfterRank:
+    case ppfMessageType_Leaderboard_GetEntriesByIds:
+    case ppfMessageType_Leaderboard_GetNextEntries:
+    case ppfMessageType_Leaderboard_GetPreviousEntries:
+    case ppfMessageType_Leaderboard_WriteEntry:
+    case ppfMessageType_Leaderboard_WriteEntryWithSupplementaryMetric:
+    case ppfMessageType_AssetFile_DeleteById:
+    case ppfMessageType_AssetFile_DeleteByName:
+    case ppfMessageType_AssetFile_DownloadById:
+    case ppfMessageType_AssetFile_DownloadByName:
+    case ppfMessageType_AssetFile_DownloadCancelById:
+    case ppfMessageType_AssetFile_DownloadCancelByName:
+    case ppfMessageType_AssetFile_GetList:
+    case ppfMessageType_AssetFile_StatusById:
+    case ppfMessageType_AssetFile_StatusByName:
+    case ppfMessageType_AssetFile_GetNextAssetDetailsArrayPage:
+    case ppfMessageType_Notification_AssetFile_DownloadUpdate:
+    case ppfMessageType_Notification_AssetFile_DeleteForSafety:
+        return EMessageLane::Bulk;
+    default:
+        return EMessageLane::Default;
+    }
+}
+
 void FOnlineAsyncTaskManagerPico::TickTask()
 {
-    for (;;)
+    SCOPE_CYCLE_COUNTER(STAT_PicoOnline_MessagePump);
+
+    // Pop everything the platform has queued so the lanes can reorder it
+    const double Now = FPlatformTime::Seconds();
+    for (int32 PopCount = 0; PopCount < PicoMaxMessagePopsPerTick; ++PopCount)
     {
         ppfMessageHandle MessageHandle = ppf_PopMessage();
         if (!MessageHandle)
         {
             break;
         }
-        UE_LOG_ONLINE(Log, TEXT("OnlineTick Receive Message !"));
-        bool bIsError = ppf_Message_IsError(MessageHandle);
-        ppfRequest RequestId = ppf_Message_GetRequestID(MessageHandle);
-        UE_LOG_ONLINE(Log, TEXT("Receive request id: %llu!"), RequestId);
+        const EMessageLane Lane = GetMessageLane(ppf_Message_GetType(MessageHandle));
+        PendingMessages[static_cast<int32>(Lane)].Add({ MessageHandle, Now });
+    }
 
-        if (RequestTaskMap.Contains(RequestId))
+    const int32 MaxMessages = CVarPicoMaxMessagesPerTick.GetValueOnGameThread();
+    const float BudgetMs = CVarPicoMessageBudgetMs.GetValueOnGameThread();
+    const double Deadline = Now + BudgetMs / 1000.0;
+    int32 NumDispatched = 0;
+    double MaxAgeSeconds = 0.0;
+    bool bBudgetExhausted = false;
+    for (TArray<FPendingMessage>& LaneMessages : PendingMessages)
+    {
+        int32 NumDispatchedInLane = 0;
+        while (NumDispatchedInLane < LaneMessages.Num())
         {
-            auto Item = RequestTaskMap[RequestId];
-            Item->TaskReceiveMessage(MessageHandle, bIsError);
-            delete Item;
-            Item = nullptr;
-            RequestTaskMap.Remove(RequestId);
-            break;
+            if (NumDispatched > 0
+                && ((MaxMessages > 0 && NumDispatched >= MaxMessages) || (BudgetMs > 0.f && FPlatformTime::Seconds() >= Deadline)))
+            {
+                bBudgetExhausted = true;
+                break;
+            }
+            const FPendingMessage& PendingMessage = LaneMessages[NumDispatchedInLane++];
+            MaxAgeSeconds = FMath::Max(MaxAgeSeconds, Now - PendingMessage.ReceivedTime);
+            DispatchMessage(PendingMessage.MessageHandle);
+            ++NumDispatched;
         }
-
-        ppfMessageType MessageType = ppf_Message_GetType(MessageHandle);
-        if (NotificationMap.Contains(MessageType))
+        LaneMessages.RemoveAt(0, NumDispatchedInLane, false);
+        if (bBudgetExhausted)
         {
-            UE_LOG_ONLINE(Log, TEXT("Receive MessageTypeID: %i"), static_cast<int32>(MessageType));
-            FOnlineAsyncEventPico* NewEvent = new FOnlineAsyncEventPico(PicoSubsystem, MessageHandle, bIsError, NotificationMap[MessageType]);
-            NewEvent->TriggerDelegates();
-            delete NewEvent;
-            NewEvent = nullptr;
             break;
         }
-        ppf_FreeMessage(MessageHandle);
     }
+
+    SET_DWORD_STAT(STAT_PicoOnline_MessagesDispatched, NumDispatched);
+    SET_DWORD_STAT(STAT_PicoOnline_PendingRealtime, PendingMessages[static_cast<int32>(EMessageLane::Realtime)].Num());
+    SET_DWORD_STAT(STAT_PicoOnline_PendingDefault, PendingMessages[static_cast<int32>(EMessageLane::Default)].Num());
+    SET_DWORD_STAT(STAT_PicoOnline_PendingBulk, PendingMessages[static_cast<int32>(EMessageLane::Bulk)].Num());
+    SET_FLOAT_STAT(STAT_PicoOnline_MaxMessageAgeMs, MaxAgeSeconds * 1000.0);
+}
+
+void FOnlineAsyncTaskManagerPico::DispatchMessage(ppfMessageHandle MessageHandle)
+{
+    UE_LOG_ONLINE(Verbose, TEXT("OnlineTick Receive Message !"));
+    bool bIsError = ppf_Message_IsError(MessageHandle);
+    ppfRequest RequestId = ppf_Message_GetRequestID(MessageHandle);
+    UE_LOG_ONLINE(Verbose, TEXT("Receive request id: %llu!"), RequestId);
+
+    FOnlineAsyncTaskPico* Item = nullptr;
+    if (RequestTaskMap.RemoveAndCopyValue(RequestId, Item))
+    {
+        Item->TaskReceiveMessage(MessageHandle, bIsError);
+        delete Item;
+        return;
+    }
+
+    ppfMessageType MessageType = ppf_Message_GetType(MessageHandle);
+    if (FPicoMulticastMessageOnCompleteDelegate* NotifyDelegate = NotificationMap.Find(MessageType))
+    {
+        UE_LOG_ONLINE(Verbose, TEXT("Receive MessageTypeID: %i"), static_cast<int32>(MessageType));
+        FOnlineAsyncEventPico NewEvent(PicoSubsystem, MessageHandle, bIsError, *NotifyDelegate);
+        NewEvent.TriggerDelegates();
+        return;
+    }
+    ppf_FreeMessage(MessageHandle);
 }
 
 void FOnlineAsyncTaskManagerPico::CollectedRequestTask(ppfRequest Request, FOnlineAsyncTaskPico* InTask)
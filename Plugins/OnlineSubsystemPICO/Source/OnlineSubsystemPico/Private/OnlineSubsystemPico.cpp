@@ -273,6 +273,11 @@ bool FOnlineSubsystemPico::Shutdown()
 {
     UE_LOG_ONLINE(Display, TEXT("FOnlineSubsystemPico::Shutdown()"));
 
+    // Queued leaderboard writes would otherwise be lost
+    if (LeaderboardInterface.IsValid())
+    {
+        LeaderboardInterface->FlushPendingWrites();
+    }
     FOnlineSubsystemImpl::Shutdown();
     RtcPicoUserInterface.Reset();
     PicoPresenceInterface.Reset();
@@ -332,6 +337,10 @@ bool FOnlineSubsystemPico::Tick(float DeltaTime)
     {
         GameSessionInterface->TickPendingInvites(DeltaTime);
     }
+    if (LeaderboardInterface.IsValid())
+    {
+        LeaderboardInterface->TickPendingWrites(DeltaTime);
+    }
 
     if (OnlineAsyncTaskThreadRunnable)
     {
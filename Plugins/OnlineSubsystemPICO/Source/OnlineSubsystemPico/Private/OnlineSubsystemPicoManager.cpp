@@ -549,7 +549,7 @@ void UOnlineSubsystemPicoManager::OnRtcLocalAudioPropertiesReport(TArray<ERtcStr
     OnRtcLocalAudioPropertiesReportDelegate.Broadcast(StreamIndexs, Volumes);
 }
 
-void UOnlineSubsystemPicoManager::OnRtcRemoteAudioPropertiesReport(int TotalRemoteVolume, TArray<int> Volumes, const TArray<FString>& RoomIds, const TArray<FString>& UserIds, TArray<ERtcStreamIndex> StreamIndexs)
+void UOnlineSubsystemPicoManager::OnRtcRemoteAudioPropertiesReport(int TotalRemoteVolume, const TArray<int>& Volumes, const TArray<FString>& RoomIds, const TArray<FString>& UserIds, const TArray<ERtcStreamIndex>& StreamIndexs)
 {
     OnRtcRemoteAudioPropertiesReportDelegate.Broadcast(TotalRemoteVolume, Volumes, RoomIds, UserIds, StreamIndexs);
 }
@@ -8,6 +8,7 @@
 
 #include "Modules/ModuleManager.h"
 #include "Misc/ConfigCacheIni.h"
+#include "Stats/Stats.h"
 
 #include "OnlineSubsystemPico.h"
 #include "OnlineSubsystemPicoModule.h"
@@ -21,6 +22,10 @@
 /** pre-pended to all Pico logging */
 #undef ONLINE_LOG_PREFIX
 #define ONLINE_LOG_PREFIX TEXT("Pico: ")
+
+/** Stat group of the message pump and the leaderboard write queue, shown with "stat PicoOnline" */
+DECLARE_STATS_GROUP(TEXT("PicoOnline"), STATGROUP_PicoOnline, STATCAT_Advanced);
+
 /** Pico Platform SDK header*/
 #include "PPF_Platform.h"
 /**
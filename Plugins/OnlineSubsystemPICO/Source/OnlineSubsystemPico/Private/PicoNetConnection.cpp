@@ -3,6 +3,7 @@
 // Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
 
 #include "PicoNetConnection.h"
+#include "PicoNetDriver.h"
 #include "OnlineSubsystemPicoPrivate.h"
 #include "IPAddressPico.h"
 #include "Net/DataChannel.h"
@@ -53,6 +54,7 @@ void UPicoNetConnection::InitLocalConnection(UNetDriver* InDriver, class FSocket
 #endif
     PeerID = PicoAddr.GetID();
     UserID = PicoAddr.GetStrID();
+    PeerHandle = static_cast<UPicoNetDriver*>(InDriver)->InternPeer(UserID);
 }
 
 void UPicoNetConnection::InitRemoteConnection(UNetDriver* InDriver, class FSocket* InSocket, const FURL& InURL, const class FInternetAddr& InRemoteAddr, EConnectionState InState, int32 InMaxPacket, int32 InPacketOverhead)
@@ -73,6 +75,7 @@ void UPicoNetConnection::InitRemoteConnection(UNetDriver* InDriver, class FSocke
     RemoteAddr = InRemoteAddr.Clone();
     PeerID = StaticCastSharedPtr<FInternetAddrPico>(RemoteAddr)->GetID();
     UserID = StaticCastSharedPtr<FInternetAddrPico>(RemoteAddr)->GetStrID();
+    PeerHandle = static_cast<UPicoNetDriver*>(InDriver)->InternPeer(UserID);
 
     // This is for a client that needs to log in, setup ClientLoginState and ExpectedClientLoginMsgType to reflect that
     SetClientLoginState(EClientLoginState::LoggingIn);
@@ -129,10 +132,12 @@ void UPicoNetConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTra
     LowLevelSendDel.ExecuteIfBound((void*)DataToSend, CountBytes, bBlockSend);
 #endif
 
-    if (!bBlockSend && CountBytes > 0)
+    // The driver clears its peer table on shutdown, so the handle can outlive the UTF-8 buffer it points at
+    const ANSICHAR* UTF8UserID = static_cast<UPicoNetDriver*>(Driver)->GetPeerUTF8UserID(PeerHandle);
+    if (!bBlockSend && CountBytes > 0 && UTF8UserID)
     {
         UE_LOG(LogNetTraffic, VeryVerbose, TEXT("Low level send to: %llu Count: %d, UserID: %s"), PeerID, CountBytes, *UserID);
-        ppf_Net_SendPacket(TCHAR_TO_UTF8(*UserID), static_cast<size_t>(CountBytes), DataToSend);
+        ppf_Net_SendPacket(UTF8UserID, static_cast<size_t>(CountBytes), DataToSend);
     }
 }
 
@@ -114,7 +114,7 @@ bool UPicoNetDriver::InitConnect(FNetworkNotify* InNotify, const FURL& ConnectUR
     // Set it as the server connection before anything else so everything knows this is a client
     ServerConnection = Connection;
     Connection->InitLocalConnection(this, nullptr, ConnectURL, USOCK_Open);
-    Connections.Add(PicoAddr.GetStrID(), Connection);
+    Peers[InternPeer(PicoAddr.GetStrID())].Connection = Connection;
 
     // Create the control channel so we can send the Hello message
     CreateInitialClientChannels();
@@ -165,13 +165,14 @@ void UPicoNetDriver::TickDispatch(float DeltaTime)
         bool bIgnorePacket = false;
 
         auto SenderID = ppf_Packet_GetSenderID(Packet);
-        FString SenderIDStr = UTF8_TO_TCHAR(SenderID);
         auto PacketSize = static_cast<int32>(ppf_Packet_GetSize(Packet));
         auto Data = (uint8*)ppf_Packet_GetBytes(Packet);
+        const int32 PeerHandle = FindPeer(SenderID);
+        FPicoPeer* Peer = PeerHandle != INDEX_NONE ? &Peers[PeerHandle] : nullptr;
 
         // The server must check the pending client connections first to see if any clients are challenging the server
         // This logic is basically the same as the one in IpNetDriver
-        if (IsServer() && PendingClientConnections.Contains(SenderIDStr))
+        if (IsServer() && Peer && Peer->bPendingChallenge)
         {
             bool bPassedChallenge = false;
             TSharedPtr<StatelessConnectHandlerComponent> StatelessConnect;
@@ -181,11 +182,12 @@ void UPicoNetDriver::TickDispatch(float DeltaTime)
                 UE_LOG(LogNet, Log,
                     TEXT("Invalid ConnectionlessHandler (%i) or StatelessConnectComponent (%i); can't accept connections."),
                     (int32)(ConnectionlessHandler.IsValid()), (int32)(StatelessConnectComponent.IsValid()));
+                ppf_Packet_Free(Packet);
                 continue;
             }
 
-            UE_LOG(LogNet, Verbose, TEXT("Checking challenge from: %s"), *SenderIDStr);
-            TSharedPtr<FInternetAddr> PicoAddr = MakeShareable(new FInternetAddrPico(SenderIDStr));
+            UE_LOG(LogNet, Verbose, TEXT("Checking challenge from: %s"), *Peer->UserID);
+            TSharedPtr<FInternetAddr> PicoAddr = Peer->Address;
             StatelessConnect = StatelessConnectComponent.Pin();
             const ProcessedPacket UnProcessedPacket = ConnectionlessHandler->IncomingConnectionless(PicoAddr, Data, PacketSize);
             bool bRestartedHandshake = false;
@@ -193,14 +195,14 @@ void UPicoNetDriver::TickDispatch(float DeltaTime)
 
             if (bPassedChallenge)
             {
-                PendingClientConnections.Remove(SenderIDStr);
+                Peer->bPendingChallenge = false;
                 PacketSize = FMath::DivideAndRoundUp(UnProcessedPacket.CountBits, 8);
                 if (PacketSize > 0)
                 {
                     Data = UnProcessedPacket.Data;
                 }
 
-                UE_LOG(LogNet, Log, TEXT("Server accepting post-challenge connection from: %s"), *SenderIDStr);
+                UE_LOG(LogNet, Log, TEXT("Server accepting post-challenge connection from: %s"), *Peer->UserID);
 
                 // Create an unreal connection to the client
                 UPicoNetConnection* Connection = NewObject<UPicoNetConnection>(NetConnectionClass);
@@ -210,7 +212,7 @@ void UPicoNetDriver::TickDispatch(float DeltaTime)
 
                 AddClientConnection(Connection);
 
-                Connections.Add(SenderIDStr, Connection);
+                Peer->Connection = Connection;
 
                 // Set the initial packet sequence from the handshake data
                 if (StatelessConnect.IsValid())
@@ -240,15 +242,15 @@ void UPicoNetDriver::TickDispatch(float DeltaTime)
             }
             else
             {
-                UE_LOG(LogNet, Warning, TEXT("Server failed post-challenge connection from: %s"), *SenderIDStr);
+                UE_LOG(LogNet, Warning, TEXT("Server failed post-challenge connection from: %s"), *Peer->UserID);
                 bIgnorePacket = true;
             }
         }
 
         // Process the packet if we aren't suppose to ignore it
-        if (!bIgnorePacket && Connections.Contains(SenderIDStr))
+        if (!bIgnorePacket && Peer && Peer->Connection)
         {
-            auto Connection = Connections[SenderIDStr];
+            auto Connection = Peer->Connection;
 #if ENGINE_MAJOR_VERSION > 4
             if (Connection->GetConnectionState() == EConnectionState::USOCK_Open)
 #elif ENGINE_MINOR_VERSION > 24
@@ -261,12 +263,12 @@ void UPicoNetDriver::TickDispatch(float DeltaTime)
             else
             {
                 // This can happen on non-seamless map travels
-                UE_LOG(LogNet, Verbose, TEXT("Got a packet but the connection is closed to: %s"), *SenderIDStr);
+                UE_LOG(LogNet, Verbose, TEXT("Got a packet but the connection is closed to: %s"), *Peer->UserID);
             }
         }
-        else
+        else if (!bIgnorePacket)
         {
-            UE_LOG(LogNet, Warning, TEXT("There is no connection to: %s"), *SenderIDStr);
+            UE_LOG(LogNet, Warning, TEXT("There is no connection to: %s"), UTF8_TO_TCHAR(SenderID));
         }
         ppf_Packet_Free(Packet);
     }
@@ -279,56 +281,123 @@ void UPicoNetDriver::LowLevelSend(TSharedPtr<const FInternetAddr> Address, void*
         return UIpNetDriver::LowLevelSend(Address, Data, CountBits, Traits);
     }
 
-#if ENGINE_MAJOR_VERSION > 4
-    FInternetAddrPico PicoAddr = FInternetAddrPico::FromUrl(FURL(nullptr, *Address->ToString(false), ETravelType::TRAVEL_Absolute));
-#elif ENGINE_MINOR_VERSION > 26
-    FInternetAddrPico PicoAddr = FInternetAddrPico::FromUrl(FURL(nullptr, *Address->ToString(false), ETravelType::TRAVEL_Absolute));
-#elif ENGINE_MINOR_VERSION > 24
-    FInternetAddrPico PicoAddr(FURL(nullptr, *Address->ToString(false), ETravelType::TRAVEL_Absolute));
-#endif
+    if (!IsSessionReady())
+    {
+        return;
+    }
 
-    ppfID PeerID = PicoAddr.GetID();
-    FString UserID = PicoAddr.GetStrID();
-    if (IOnlineSubsystem* Subsystem = IOnlineSubsystem::Get())
+    // Only handshake traffic goes through here, so a peer we have not seen yet is interned on its first send
+    int32 PeerHandle = FindPeer(*Address);
+    if (PeerHandle == INDEX_NONE)
     {
-        auto PicoSubsystem = static_cast<FOnlineSubsystemPico*>(Subsystem);
-        if (PicoSubsystem && PicoSubsystem->Init() && PicoSubsystem->GetGameSessionInterface())
-        {
-            auto SessionInterface = PicoSubsystem->GetGameSessionInterface();
-            if (!SessionInterface->IsInitSuccess())
-            {
-                return;
-            }
-            const uint8* DataToSend = reinterpret_cast<uint8*>(Data);
+        PeerHandle = InternPeer(Address->ToString(false));
+    }
 
-            if (ConnectionlessHandler.IsValid())
-            {
-                const ProcessedPacket ProcessedData =
-                    ConnectionlessHandler->OutgoingConnectionless(Address, (uint8*)DataToSend, CountBits, Traits);
+    const uint8* DataToSend = reinterpret_cast<uint8*>(Data);
 
-                if (!ProcessedData.bError)
-                {
-                    DataToSend = ProcessedData.Data;
-                    CountBits = ProcessedData.CountBits;
-                }
-                else
-                {
-                    CountBits = 0;
-                }
-            }
-            int32 BytesSent = 0;
-            uint32 CountBytes = FMath::DivideAndRoundUp(CountBits, 8);
+    if (ConnectionlessHandler.IsValid())
+    {
+        const ProcessedPacket ProcessedData =
+            ConnectionlessHandler->OutgoingConnectionless(Address, (uint8*)DataToSend, CountBits, Traits);
 
-            if (CountBits > 0)
-            {
-                ppf_Net_SendPacket(TCHAR_TO_UTF8(*UserID), static_cast<size_t>(CountBytes), DataToSend);
-            }
+        if (!ProcessedData.bError)
+        {
+            DataToSend = ProcessedData.Data;
+            CountBits = ProcessedData.CountBits;
         }
         else
         {
-            UE_LOG(LogNet, Warning, TEXT("There is no connection to: %s"), *UserID);
+            CountBits = 0;
+        }
+    }
+    uint32 CountBytes = FMath::DivideAndRoundUp(CountBits, 8);
+
+    if (CountBits > 0)
+    {
+        ppf_Net_SendPacket(GetPeerUTF8UserID(PeerHandle), static_cast<size_t>(CountBytes), DataToSend);
+    }
+}
+
+int32 UPicoNetDriver::InternPeer(const FString& UserID)
+{
+    for (int32 PeerHandle = 0; PeerHandle < Peers.Num(); ++PeerHandle)
+    {
+        if (Peers[PeerHandle].UserID == UserID)
+        {
+            return PeerHandle;
+        }
+    }
+
+    FTCHARToUTF8 UTF8UserID(*UserID);
+    FPicoPeer& Peer = Peers.AddDefaulted_GetRef();
+    Peer.UserID = UserID;
+    Peer.UTF8UserID.Append((const ANSICHAR*)UTF8UserID.Get(), UTF8UserID.Length());
+    Peer.UTF8UserID.Add('\0');
+    Peer.UTF8Hash = FCrc::StrCrc32(Peer.UTF8UserID.GetData());
+    Peer.Address = MakeShareable(new FInternetAddrPico(UserID));
+    Peer.Connection = nullptr;
+    Peer.bPendingChallenge = false;
+
+    UE_LOG(LogNet, Verbose, TEXT("Interned peer %s as handle %d"), *UserID, Peers.Num() - 1);
+    return Peers.Num() - 1;
+}
+
+int32 UPicoNetDriver::FindPeer(const ANSICHAR* UTF8UserID) const
+{
+    if (!UTF8UserID)
+    {
+        return INDEX_NONE;
+    }
+
+    // There are only a handful of peers, so a scan over the hashes beats building a key for a map lookup
+    const uint32 Hash = FCrc::StrCrc32(UTF8UserID);
+    for (int32 PeerHandle = 0; PeerHandle < Peers.Num(); ++PeerHandle)
+    {
+        const FPicoPeer& Peer = Peers[PeerHandle];
+        if (Peer.UTF8Hash == Hash && FCStringAnsi::Strcmp(Peer.UTF8UserID.GetData(), UTF8UserID) == 0)
+        {
+            return PeerHandle;
+        }
+    }
+    return INDEX_NONE;
+}
+
+int32 UPicoNetDriver::FindPeer(const FInternetAddr& Address) const
+{
+    // The stateless handshake replies to the address we gave it
+    for (int32 PeerHandle = 0; PeerHandle < Peers.Num(); ++PeerHandle)
+    {
+        if (Peers[PeerHandle].Address.Get() == &Address)
+        {
+            return PeerHandle;
+        }
+    }
+
+    const FString UserID = Address.ToString(false);
+    for (int32 PeerHandle = 0; PeerHandle < Peers.Num(); ++PeerHandle)
+    {
+        if (Peers[PeerHandle].UserID == UserID)
+        {
+            return PeerHandle;
+        }
+    }
+    return INDEX_NONE;
+}
+
+bool UPicoNetDriver::IsSessionReady()
+{
+    FOnlineSessionPicoPtr SessionInterface = CachedSessionInterface.Pin();
+    if (!SessionInterface.IsValid())
+    {
+        auto PicoSubsystem = static_cast<FOnlineSubsystemPico*>(IOnlineSubsystem::Get(PICO_SUBSYSTEM));
+        if (!PicoSubsystem || !PicoSubsystem->Init())
+        {
+            return false;
         }
+        SessionInterface = PicoSubsystem->GetGameSessionInterface();
+        CachedSessionInterface = SessionInterface;
     }
+    return SessionInterface.IsValid() && SessionInterface->IsInitSuccess();
 }
 
 bool UPicoNetDriver::AddNewClientConnection(const FString& UserID)
@@ -342,11 +411,10 @@ bool UPicoNetDriver::AddNewClientConnection(const FString& UserID)
 
     UE_LOG(LogNet, Verbose, TEXT("New incoming peer request: %s"), *UserID);
 
-    // todo
-    // Add to the list of clients we are expecting a challenge from
-    PendingClientConnections.Add(UserID, USOCK_Open);
-    // Remove it from existing connections map if it exists.
-    Connections.Remove(UserID);
+    // Add to the list of clients we are expecting a challenge from, dropping any previous connection
+    FPicoPeer& Peer = Peers[InternPeer(UserID)];
+    Peer.bPendingChallenge = true;
+    Peer.Connection = nullptr;
 
     return true;
 }
@@ -359,6 +427,8 @@ void UPicoNetDriver::Shutdown()
         return;
     }
     UNetDriver::Shutdown();
+    Peers.Empty();
+    CachedSessionInterface.Reset();
     UE_LOG(LogNet, Verbose, TEXT("Pico Net Driver shutdown"));
 }
 
@@ -0,0 +1,109 @@
+// Copyright 2022 Pico Technology Co., Ltd.All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc.In the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/Parse.h"
+
+/**
+ * Parameters, timing table and correctness checks of the online subsystem benchmark console commands. They need no
+ * device or platform SDK, e.g.
+ *   UE4Editor Prototypes -game -nullrhi -unattended -stdout -ExecCmds="pico.Rtc.BenchmarkSpeakerTable Users=16,quit"
+ * A failed check is logged as an error and raises an ensure, and exits with code 1 under -unattended.
+ */
+class FPicoOnlineBenchmark
+{
+public:
+    enum class EUnit
+    {
+        Nanoseconds,
+        Microseconds
+    };
+
+    FPicoOnlineBenchmark(const TCHAR* InName, const TArray<FString>& Args, FOutputDevice& InAr)
+        : Ar(InAr)
+        , Name(InName)
+        , Params(FString::Join(Args, TEXT(" ")))
+        , Unit(EUnit::Nanoseconds)
+        , NumFailures(0)
+    {
+    }
+
+    /** Value of Key (e.g. TEXT("Frames=")) on the command line, Default when it is not given */
+    template<typename ValueType>
+    ValueType Param(const TCHAR* Key, ValueType Default) const
+    {
+        ValueType Value = Default;
+        FParse::Value(*Params, Key, Value);
+        return Value;
+    }
+
+    /** Starts the Path/Avg table, rows give the average time of Count operations in Unit */
+    void BeginTable(EUnit InUnit)
+    {
+        Unit = InUnit;
+        Ar.Logf(TEXT("%-24s %10s"), TEXT("Path"), Unit == EUnit::Nanoseconds ? TEXT("Avg ns") : TEXT("Avg us"));
+    }
+
+    void Row(const TCHAR* Path, uint64 Cycles, int64 Count) const
+    {
+        if (Unit == EUnit::Nanoseconds)
+        {
+            Ar.Logf(TEXT("%-24s %10.1f"), Path, AverageNanoseconds(Cycles, Count));
+        }
+        else
+        {
+            Ar.Logf(TEXT("%-24s %10.2f"), Path, AverageNanoseconds(Cycles, Count) / 1000.0);
+        }
+    }
+
+    static double AverageNanoseconds(uint64 Cycles, int64 Count)
+    {
+        return FPlatformTime::ToMilliseconds64(Cycles) * 1000000.0 / FMath::Max<int64>(Count, 1);
+    }
+
+    /** Fails the run unless bCondition holds, Fmt describes what was compared */
+    template<typename FmtType, typename... Types>
+    bool Check(bool bCondition, const FmtType& Fmt, Types... Args)
+    {
+        if (!bCondition)
+        {
+            NumFailures++;
+            const FString Message = FString::Printf(Fmt, Args...);
+            Ar.Logf(ELogVerbosity::Error, TEXT("%s: check failed: %s"), Name, *Message);
+            ensureMsgf(false, TEXT("%s: check failed: %s"), Name, *Message);
+        }
+        return bCondition;
+    }
+
+    /** Prints the verdict and returns the number of failed checks */
+    int32 Finish() const
+    {
+        if (NumFailures == 0)
+        {
+            Ar.Logf(TEXT("%s: passed"), Name);
+            return 0;
+        }
+        Ar.Logf(ELogVerbosity::Error, TEXT("%s: FAILED, %d check(s) did not hold"), Name, NumFailures);
+        if (FApp::IsUnattended())
+        {
+            FPlatformMisc::RequestExitWithStatus(false, 1);
+        }
+        return NumFailures;
+    }
+
+    FOutputDevice& Ar;
+
+private:
+    const TCHAR* Name;
+    FString Params;
+    EUnit Unit;
+    int32 NumFailures;
+};
+#endif
@@ -7,14 +7,11 @@
 #include "OnlineSubsystemPicoPrivate.h"
 #include "PPF_RtcEngineInitResult.h"
 
-#if PLATFORM_WINDOWS
-#include <stdio.h>
-#endif
-
 DEFINE_LOG_CATEGORY(RtcInterface);
 
 FRTCPicoUserInterface::FRTCPicoUserInterface(FOnlineSubsystemPico& InSubsystem) :
-    PicoSubsystem(InSubsystem)
+    PicoSubsystem(InSubsystem),
+    RemoteSpeakers(RtcIds)
 {
     OnJoinRoomNotificationResultHandle =
         PicoSubsystem.GetOrAddNotify(ppfMessageType_Notification_Rtc_OnJoinRoom)
@@ -291,14 +288,21 @@ void FRTCPicoUserInterface::GetToken(const FString& UserId, const FString& RoomI
 
 int32 FRTCPicoUserInterface::RtcSendStreamSyncInfo(int32 Info, ERtcStreamIndex InStreamIndex, int32 RepeatCount, ERtcSyncInfoStreamType InSyncInfoStreamType)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::RtcSendStreamSyncInfo!"));
+    uint8 Bytes[4];
+    const int32 NumBytes = GetBytesByInt(Info, Bytes);
+    return RtcSendStreamSyncInfo(TArrayView<const uint8>(Bytes, NumBytes), InStreamIndex, RepeatCount, InSyncInfoStreamType);
+}
+
+int32 FRTCPicoUserInterface::RtcSendStreamSyncInfo(TArrayView<const uint8> Data, ERtcStreamIndex InStreamIndex, int32 RepeatCount, ERtcSyncInfoStreamType InSyncInfoStreamType)
+{
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::RtcSendStreamSyncInfo!"));
 #if PLATFORM_ANDROID
-    auto RtcStreamSyncInfoOptions = ppf_RtcStreamSyncInfoOptions_Create();
     if (InStreamIndex == ERtcStreamIndex::None || InSyncInfoStreamType == ERtcSyncInfoStreamType::None)
     {
         UE_LOG(RtcInterface, Log, TEXT("RtcSendStreamSyncInfo wrong param!"));
         return -1;
     }
+    auto RtcStreamSyncInfoOptions = ppf_RtcStreamSyncInfoOptions_Create();
     ppfRtcStreamIndex pRtcStreamIndex;
     if (InStreamIndex == ERtcStreamIndex::Main)
     {
@@ -312,12 +316,8 @@ int32 FRTCPicoUserInterface::RtcSendStreamSyncInfo(int32 Info, ERtcStreamIndex I
     ppf_RtcStreamSyncInfoOptions_SetStreamIndex(RtcStreamSyncInfoOptions, pRtcStreamIndex);
     ppf_RtcStreamSyncInfoOptions_SetRepeatCount(RtcStreamSyncInfoOptions, RepeatCount);
     ppf_RtcStreamSyncInfoOptions_SetStreamType(RtcStreamSyncInfoOptions, pRtcSyncInfoStreamType);
-    TArray<uint8> Res = GetBytesByInt(Info);
-    int32 Length = Res.Num();
-    //uint8* Res = nullptr;
-    //int32 Length = 0;
-    //StringToBytes(FString::FromInt(Info), Res, Length);
-    int32 ReturnCode = ppf_Rtc_SendStreamSyncInfo(Res.GetData(), Length, RtcStreamSyncInfoOptions);
+    // The SDK only reads the data, its signature just is not const
+    int32 ReturnCode = ppf_Rtc_SendStreamSyncInfo(const_cast<uint8*>(Data.GetData()), Data.Num(), RtcStreamSyncInfoOptions);
     ppf_RtcStreamSyncInfoOptions_Destroy(RtcStreamSyncInfoOptions);
     return ReturnCode;
 #endif
@@ -438,12 +438,18 @@ void FRTCPicoUserInterface::RtcRoomUnsubscribeStream(const FString& RoomId, cons
 
 int64 FRTCPicoUserInterface::RtcSendRoomBinaryMessage(const FString& RoomId, const FString& MessageInfo)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::RtcSendRoomBinaryMessage!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::RtcSendRoomBinaryMessage!"));
+    StringMessageBytes.SetNumUninitialized(MessageInfo.Len(), false);
+    int32 NumBytes = StringToBytes(MessageInfo, StringMessageBytes.GetData(), StringMessageBytes.Num());
+    return RtcSendRoomBinaryMessage(RoomId, TArrayView<const uint8>(StringMessageBytes.GetData(), NumBytes));
+}
+
+int64 FRTCPicoUserInterface::RtcSendRoomBinaryMessage(const FString& RoomId, TArrayView<const uint8> Data)
+{
 #if PLATFORM_ANDROID
-    TArray<uint8> Bytes;
-    Bytes.SetNumUninitialized(MessageInfo.Len());
-    int32 NumBytes = StringToBytes(MessageInfo, Bytes.GetData(), Bytes.Num());
-    return ppf_Rtc_SendRoomBinaryMessage(TCHAR_TO_UTF8(*RoomId), Bytes.GetData(), NumBytes);
+    // Only IDs the SDK reported are interned, an ID the game made up is converted for this call
+    const int32 RoomHandle = RtcIds.Find(RoomId);
+    return ppf_Rtc_SendRoomBinaryMessage(RoomHandle != INDEX_NONE ? RtcIds.GetUTF8Id(RoomHandle) : TCHAR_TO_UTF8(*RoomId), const_cast<uint8*>(Data.GetData()), Data.Num());
 #endif
     return -1;
 }
@@ -459,12 +465,21 @@ int64 FRTCPicoUserInterface::RtcSendRoomMessage(const FString& RoomId, const FSt
 
 int64 FRTCPicoUserInterface::RtcSendUserBinaryMessage(const FString& RoomId, const FString& UserId, const FString& MessageInfo)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::RtcSendUserBinaryMessage!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::RtcSendUserBinaryMessage!"));
+    StringMessageBytes.SetNumUninitialized(MessageInfo.Len(), false);
+    int32 NumBytes = StringToBytes(MessageInfo, StringMessageBytes.GetData(), StringMessageBytes.Num());
+    return RtcSendUserBinaryMessage(RoomId, UserId, TArrayView<const uint8>(StringMessageBytes.GetData(), NumBytes));
+}
+
+int64 FRTCPicoUserInterface::RtcSendUserBinaryMessage(const FString& RoomId, const FString& UserId, TArrayView<const uint8> Data)
+{
 #if PLATFORM_ANDROID
-    TArray<uint8> Bytes;
-    Bytes.SetNumUninitialized(MessageInfo.Len());
-    int32 NumBytes = StringToBytes(MessageInfo, Bytes.GetData(), Bytes.Num());
-    return ppf_Rtc_SendUserBinaryMessage(TCHAR_TO_UTF8(*RoomId), TCHAR_TO_UTF8(*UserId), Bytes.GetData(), NumBytes);
+    const int32 RoomHandle = RtcIds.Find(RoomId);
+    const int32 UserHandle = RtcIds.Find(UserId);
+    return ppf_Rtc_SendUserBinaryMessage(
+        RoomHandle != INDEX_NONE ? RtcIds.GetUTF8Id(RoomHandle) : TCHAR_TO_UTF8(*RoomId),
+        UserHandle != INDEX_NONE ? RtcIds.GetUTF8Id(UserHandle) : TCHAR_TO_UTF8(*UserId),
+        const_cast<uint8*>(Data.GetData()), Data.Num());
 #endif
     return -1;
 }
@@ -478,34 +493,20 @@ int64 FRTCPicoUserInterface::RtcSendUserMessage(const FString& RoomId, const FSt
     return -1;
 }
 
-TArray<uint8> FRTCPicoUserInterface::GetBytesByInt(int32 Inint)
+int32 FRTCPicoUserInterface::GetBytesByInt(int32 Inint, uint8* OutBytes)
 {
-    std::string StrRes;
-    int32 Count = 0;
-    if (Inint == 0)
+    // At least one byte, an empty payload is rejected by the SDK
+    const uint32 Value = (uint32)Inint;
+    int32 NumBytes = 1;
+    while (NumBytes < 4 && (Value >> (NumBytes * 8)) != 0)
     {
-        StrRes = "0";
+        NumBytes++;
     }
-    while (Inint && Count++ < 8)
+    for (int32 Index = 0; Index < NumBytes; Index++)
     {
-        StrRes = HEX[(Inint & 0x0f)] + StrRes;
-        Inint >>= 4;
-    }
-    TArray<uint8> Res;
-    std::string Temps;
-    int Bytelen = StrRes.length() / 2;
-    unsigned int n;
-    for (int i = 0; i < Bytelen; i++)
-    {
-        Temps = StrRes.substr(i * 2, 2);
-#if PLATFORM_ANDROID
-        sscanf(Temps.c_str(), "%x", &n);
-#elif PLATFORM_WINDOWS
-        sscanf_s(Temps.c_str(), "%x", &n);
-#endif
-        Res.Add(n);
+        OutBytes[Index] = (uint8)(Value >> ((NumBytes - 1 - Index) * 8));
     }
-    return Res;
+    return NumBytes;
 }
 
 void FRTCPicoUserInterface::OnQueryGetTokenComplete(ppfMessageHandle Message, bool bIsError, const FOnGetTokenComplete& Delegate)
@@ -572,6 +573,13 @@ void FRTCPicoUserInterface::OnLeaveRoomResult(ppfMessageHandle Message, bool bIs
 #if PLATFORM_ANDROID
     auto LeaveRoomResult = ppf_Message_GetRtcLeaveRoomResult(Message);
     FString RoomId = UTF8_TO_TCHAR(ppf_RtcLeaveRoomResult_GetRoomId(LeaveRoomResult));
+    RemoteSpeakers.RemoveRoom(RoomId);
+    if (RemoteSpeakers.NumRooms() == 0)
+    {
+        // Nothing refers to the interned IDs of the session any more, drop them instead of keeping every ID ever seen
+        RemoteSpeakers.Reset();
+        RtcIds.Reset();
+    }
     RtcLeaveRoomCallback.Broadcast(RoomId);
 #endif
 }
@@ -621,6 +629,7 @@ void FRTCPicoUserInterface::OnUserLeaveRoomResult(ppfMessageHandle Message, bool
     }
 
     FString RoomId = UTF8_TO_TCHAR((ppf_RtcUserLeaveInfo_GetRoomId(UserLeaveInfo)));
+    RemoteSpeakers.RemoveUser(RoomId, UserId);
     RtcUserLeaveInfoCallback.Broadcast(UserId, RtcUserLeaveReasonType, RoomId);
 #endif
 }
@@ -782,7 +791,8 @@ void FRTCPicoUserInterface::OnAudioPlaybackDeviceChangeNotification(ppfMessageHa
 
 void FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification!"));
+    // Reports arrive every interval for as long as they are enabled, keep them out of the default log
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("Remote audio properties report notification error!"));
@@ -792,21 +802,13 @@ void FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification(ppfMessage
     ppfRtcRemoteAudioPropertiesReportHandle RtcRemoteAudioProperitesReport = ppf_Message_GetRtcRemoteAudioPropertiesReport(Message);
     size_t S_AudioPropertiesInfosSize = ppf_RtcRemoteAudioPropertiesReport_GetAudioPropertiesInfosSize(RtcRemoteAudioProperitesReport);
     int TotalRemoteVolume = ppf_RtcRemoteAudioPropertiesReport_GetTotalRemoteVolume(RtcRemoteAudioProperitesReport);
-    TArray<FString> RoomIdArray;
-    TArray<FString> UserIdArray;
-    TArray<ERtcStreamIndex> StreamIndexArray;
-    TArray<int> VolumeArray;
+    RemoteSpeakers.BeginReport(FPlatformTime::Seconds());
     for (size_t i = 0; i < S_AudioPropertiesInfosSize; i++)
     {
         auto AudioPropertiesInfos = ppf_RtcRemoteAudioPropertiesReport_GetAudioPropertiesInfos(RtcRemoteAudioProperitesReport, i);
         auto AudioPropertiesInfo = ppf_RtcRemoteAudioPropertiesInfo_GetAudioPropertiesInfo(AudioPropertiesInfos);
         int Volume = ppf_RtcAudioPropertyInfo_GetVolume(AudioPropertiesInfo);
-        VolumeArray.Add(Volume);
         auto StreamKey = ppf_RtcRemoteAudioPropertiesInfo_GetStreamKey(AudioPropertiesInfos);
-        FString RoomId = UTF8_TO_TCHAR(ppf_RtcRemoteStreamKey_GetRoomId(StreamKey));
-        RoomIdArray.Add(RoomId);
-        FString UserId = UTF8_TO_TCHAR(ppf_RtcRemoteStreamKey_GetUserId(StreamKey));
-        UserIdArray.Add(UserId);
         ppfRtcStreamIndex RtcStreamIndex = ppf_RtcRemoteStreamKey_GetStreamIndex(StreamKey);
         ERtcStreamIndex StreamIndex = ERtcStreamIndex::None;
         if (RtcStreamIndex == ppfRtcStreamIndex_Main)
@@ -817,11 +819,13 @@ void FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification(ppfMessage
         {
             StreamIndex = ERtcStreamIndex::Screen;
         }
-        StreamIndexArray.Add(StreamIndex);
-
+        // The table matches the UTF-8 IDs against the ones it has seen, nothing is converted for known speakers
+        RemoteSpeakers.AddReportEntry(ppf_RtcRemoteStreamKey_GetRoomId(StreamKey), ppf_RtcRemoteStreamKey_GetUserId(StreamKey), StreamIndex, Volume);
     }
-    UE_LOG(RtcInterface, Log, TEXT("Remote audio properties broadcast!"));
-    RtcRemoteAudioPropertiesReportCallback.Broadcast(TotalRemoteVolume, VolumeArray, RoomIdArray, UserIdArray, StreamIndexArray);
+    RemoteSpeakers.EndReport();
+    RemoteSpeakers.CopyLastReport(RemoteReportVolumes, RemoteReportRoomIds, RemoteReportUserIds, RemoteReportStreamIndices);
+    UE_LOG(RtcInterface, Verbose, TEXT("Remote audio properties broadcast!"));
+    RtcRemoteAudioPropertiesReportCallback.Broadcast(TotalRemoteVolume, RemoteReportVolumes, RemoteReportRoomIds, RemoteReportUserIds, RemoteReportStreamIndices);
 
 #endif
 }
@@ -1061,7 +1065,7 @@ void FRTCPicoUserInterface::OnRtcUserUnPublishInfoNotification(ppfMessageHandle
 
 void FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("OnGetRtcStreamSyncInfoNotification error!"));
@@ -1069,11 +1073,15 @@ void FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification(ppfMessageHandle
     }
 #if PLATFORM_ANDROID
     auto RtcStreamSyncInfo = ppf_Message_GetRtcStreamSyncInfo(Message);
-    FString Info = BytesToString(ppf_RtcStreamSyncInfo_GetData(RtcStreamSyncInfo), ppf_RtcStreamSyncInfo_GetLength(RtcStreamSyncInfo));
+    const uint8* Data = ppf_RtcStreamSyncInfo_GetData(RtcStreamSyncInfo);
+    const int32 Length = ppf_RtcStreamSyncInfo_GetLength(RtcStreamSyncInfo);
     ppfRtcSyncInfoStreamType pRtcSyncInfoStreamType = ppf_RtcStreamSyncInfo_GetStreamType(RtcStreamSyncInfo);
     auto RtcRemoteStreamKey = ppf_RtcStreamSyncInfo_GetStreamKey(RtcStreamSyncInfo);
-    FString UserId = UTF8_TO_TCHAR(ppf_RtcRemoteStreamKey_GetUserId(RtcRemoteStreamKey));
-    FString RoomId = UTF8_TO_TCHAR(ppf_RtcRemoteStreamKey_GetRoomId(RtcRemoteStreamKey));
+    // Interned entries do not move when listeners intern more IDs, the table is only reset once every room is left
+    const int32 UserHandle = RtcIds.Intern(ppf_RtcRemoteStreamKey_GetUserId(RtcRemoteStreamKey));
+    const int32 RoomHandle = RtcIds.Intern(ppf_RtcRemoteStreamKey_GetRoomId(RtcRemoteStreamKey));
+    const FString& UserId = RtcIds.GetId(UserHandle);
+    const FString& RoomId = RtcIds.GetId(RoomHandle);
     ppfRtcStreamIndex pRtcStreamIndex = ppf_RtcRemoteStreamKey_GetStreamIndex(RtcRemoteStreamKey);
     ERtcSyncInfoStreamType RtcSyncInfoStreamType = ERtcSyncInfoStreamType::None;
     if (pRtcSyncInfoStreamType == ppfRtcSyncInfoStreamType_Audio)
@@ -1091,7 +1099,14 @@ void FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification(ppfMessageHandle
         RtcStreamIndex = ERtcStreamIndex::Screen;
     }
 
-    RtcStreamSyncInfoCallback.Broadcast(RoomId, UserId, RtcStreamIndex, RtcSyncInfoStreamType, Info);
+    if (RtcStreamSyncPayloadCallback.IsBound())
+    {
+        RtcStreamSyncPayloadCallback.Broadcast(RoomId, UserId, RtcStreamIndex, RtcSyncInfoStreamType, ReceivedPayloads.Acquire(Data, Length));
+    }
+    if (RtcStreamSyncInfoCallback.IsBound())
+    {
+        RtcStreamSyncInfoCallback.Broadcast(RoomId, UserId, RtcStreamIndex, RtcSyncInfoStreamType, BytesToString(Data, Length));
+    }
 #endif
 }
 
@@ -1114,7 +1129,7 @@ void FRTCPicoUserInterface::OnRtcMessageSendResultNotification(ppfMessageHandle
 
 void FRTCPicoUserInterface::OnRtcBinaryMessageReceivedNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnRtcBinaryMessageReceivedNotification!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnRtcBinaryMessageReceivedNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("OnRtcBinaryMessageReceivedNotification error!"));
@@ -1122,10 +1137,21 @@ void FRTCPicoUserInterface::OnRtcBinaryMessageReceivedNotification(ppfMessageHan
     }
 #if PLATFORM_ANDROID
     auto RtcBinaryMessageReceived = ppf_Message_GetRtcBinaryMessageReceived(Message);
-    FString UserId = UTF8_TO_TCHAR(ppf_RtcBinaryMessageReceived_GetUserId(RtcBinaryMessageReceived));
-    FString RoomId = UTF8_TO_TCHAR(ppf_RtcBinaryMessageReceived_GetRoomId(RtcBinaryMessageReceived));
-    FString Info = BytesToString(ppf_RtcBinaryMessageReceived_GetData(RtcBinaryMessageReceived), ppf_RtcBinaryMessageReceived_GetLength(RtcBinaryMessageReceived));
-    RtcBinaryMessageReceivedCallback.Broadcast(RoomId, UserId, Info);
+    const int32 UserHandle = RtcIds.Intern(ppf_RtcBinaryMessageReceived_GetUserId(RtcBinaryMessageReceived));
+    const int32 RoomHandle = RtcIds.Intern(ppf_RtcBinaryMessageReceived_GetRoomId(RtcBinaryMessageReceived));
+    const FString& UserId = RtcIds.GetId(UserHandle);
+    const FString& RoomId = RtcIds.GetId(RoomHandle);
+    const uint8* Data = ppf_RtcBinaryMessageReceived_GetData(RtcBinaryMessageReceived);
+    const int32 Length = ppf_RtcBinaryMessageReceived_GetLength(RtcBinaryMessageReceived);
+    // The string form is only built for listeners of the string callback
+    if (RtcBinaryPayloadReceivedCallback.IsBound())
+    {
+        RtcBinaryPayloadReceivedCallback.Broadcast(RoomId, UserId, ReceivedPayloads.Acquire(Data, Length));
+    }
+    if (RtcBinaryMessageReceivedCallback.IsBound())
+    {
+        RtcBinaryMessageReceivedCallback.Broadcast(RoomId, UserId, BytesToString(Data, Length));
+    }
 #endif
 }
 
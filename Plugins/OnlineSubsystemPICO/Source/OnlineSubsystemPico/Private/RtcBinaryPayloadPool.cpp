@@ -0,0 +1,32 @@
+// Copyright 2022 Pico Technology Co., Ltd.All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc.In the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
+
+
+#include "RtcBinaryPayloadPool.h"
+#include "RTCPicoUserInterface.h"
+
+// A message being handled and a few queued by listeners; more means a listener is holding on to payloads
+static const int32 RtcBinaryPayloadPoolWarnSize = 16;
+
+FRtcBinaryPayloadRef FRtcBinaryPayloadPool::Acquire(const uint8* Data, int32 NumBytes)
+{
+    TSharedRef<FRtcBinaryPayload, ESPMode::ThreadSafe>* FreePayload = Payloads.FindByPredicate([](const TSharedRef<FRtcBinaryPayload, ESPMode::ThreadSafe>& Payload)
+    {
+        return Payload.IsUnique();
+    });
+    if (!FreePayload)
+    {
+        FreePayload = &Payloads.Add_GetRef(MakeShared<FRtcBinaryPayload, ESPMode::ThreadSafe>());
+        if (Payloads.Num() > RtcBinaryPayloadPoolWarnSize)
+        {
+            UE_LOG(RtcInterface, Warning, TEXT("RTC binary payload pool grew to %d"), Payloads.Num());
+        }
+    }
+
+    // Reset keeps the allocation, so a buffer only grows for a payload larger than any before it
+    TArray<uint8>& Bytes = (*FreePayload)->Data;
+    Bytes.Reset(NumBytes);
+    Bytes.Append(Data, NumBytes);
+    return *FreePayload;
+}
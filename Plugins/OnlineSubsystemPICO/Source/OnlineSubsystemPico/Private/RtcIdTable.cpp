@@ -0,0 +1,90 @@
+// Copyright 2022 Pico Technology Co., Ltd.All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc.In the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
+
+
+#include "RtcIdTable.h"
+
+int32 FRtcIdTable::Intern(const ANSICHAR* UTF8Id)
+{
+    if (!UTF8Id)
+    {
+        UTF8Id = "";
+    }
+
+    const int32 ExistingHandle = Find(UTF8Id);
+    if (ExistingHandle != INDEX_NONE)
+    {
+        return ExistingHandle;
+    }
+    return Add(UTF8_TO_TCHAR(UTF8Id), UTF8Id);
+}
+
+int32 FRtcIdTable::Intern(const FString& Id)
+{
+    const int32 ExistingHandle = Find(Id);
+    if (ExistingHandle != INDEX_NONE)
+    {
+        return ExistingHandle;
+    }
+    return Add(FString(Id), FTCHARToUTF8(*Id).Get());
+}
+
+int32 FRtcIdTable::Find(const ANSICHAR* UTF8Id) const
+{
+    if (!UTF8Id)
+    {
+        return INDEX_NONE;
+    }
+
+    TArray<int32, TInlineAllocator<4>> Handles;
+    HandlesByUTF8Hash.MultiFind(FCrc::StrCrc32(UTF8Id), Handles);
+    for (int32 Handle : Handles)
+    {
+        if (FCStringAnsi::Strcmp(Ids[Handle]->UTF8Id.GetData(), UTF8Id) == 0)
+        {
+            return Handle;
+        }
+    }
+    return INDEX_NONE;
+}
+
+int32 FRtcIdTable::Find(const FString& Id) const
+{
+    TArray<int32, TInlineAllocator<4>> Handles;
+    HandlesByHash.MultiFind(FCrc::StrCrc32(*Id), Handles);
+    for (int32 Handle : Handles)
+    {
+        if (Ids[Handle]->Id.Equals(Id, ESearchCase::CaseSensitive))
+        {
+            return Handle;
+        }
+    }
+    return INDEX_NONE;
+}
+
+const FString& FRtcIdTable::GetId(int32 Handle) const
+{
+    static const FString InvalidId;
+    return Ids.IsValidIndex(Handle) ? Ids[Handle]->Id : InvalidId;
+}
+
+void FRtcIdTable::Reset()
+{
+    Ids.Reset();
+    HandlesByHash.Reset();
+    HandlesByUTF8Hash.Reset();
+}
+
+int32 FRtcIdTable::Add(FString&& Id, const ANSICHAR* UTF8Id)
+{
+    const int32 Handle = Ids.Num();
+    FInternedId& Interned = *Ids.Add_GetRef(MakeUnique<FInternedId>());
+    Interned.Hash = FCrc::StrCrc32(*Id);
+    Interned.Id = MoveTemp(Id);
+    Interned.UTF8Id.Append(UTF8Id, FCStringAnsi::Strlen(UTF8Id) + 1);
+    Interned.UTF8Hash = FCrc::StrCrc32(UTF8Id);
+    HandlesByHash.Add(Interned.Hash, Handle);
+    HandlesByUTF8Hash.Add(Interned.UTF8Hash, Handle);
+    return Handle;
+}
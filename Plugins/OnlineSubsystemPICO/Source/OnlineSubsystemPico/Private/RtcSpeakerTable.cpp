@@ -0,0 +1,197 @@
+// Copyright 2022 Pico Technology Co., Ltd.All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc.In the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
+
+
+#include "RtcSpeakerTable.h"
+#include "RTCPicoUserInterface.h"
+
+FRtcSpeakerTable::FRtcSpeakerTable(FRtcIdTable& InIds) :
+    Ids(InIds),
+    ReportSeconds(0.0),
+    PreviousReportSeconds(0.0),
+    SmoothingTimeSeconds(0.3f)
+{
+}
+
+void FRtcSpeakerTable::BeginReport(double NowSeconds)
+{
+    ReportSeconds = NowSeconds;
+    LastReport.Reset();
+}
+
+void FRtcSpeakerTable::AddReportEntry(const ANSICHAR* UTF8RoomId, const ANSICHAR* UTF8UserId, ERtcStreamIndex StreamIndex, int32 Volume)
+{
+    const int32 RoomHandle = Ids.Intern(UTF8RoomId);
+    const int32 UserHandle = Ids.Intern(UTF8UserId);
+
+    int32 RoomIndex = FindRoomIndex(RoomHandle);
+    if (RoomIndex == INDEX_NONE)
+    {
+        RoomIndex = Rooms.AddDefaulted();
+        Rooms[RoomIndex].RoomHandle = RoomHandle;
+    }
+
+    TArray<FSpeaker>& Speakers = Rooms[RoomIndex].Speakers;
+    int32 SpeakerIndex = Speakers.IndexOfByPredicate([UserHandle, StreamIndex](const FSpeaker& Speaker)
+    {
+        return Speaker.UserHandle == UserHandle && Speaker.StreamIndex == StreamIndex;
+    });
+    if (SpeakerIndex == INDEX_NONE)
+    {
+        // A new stream has no history to smooth against
+        SpeakerIndex = Speakers.Add({ UserHandle, StreamIndex, Volume, (float)Volume, ReportSeconds });
+    }
+    else
+    {
+        Speakers[SpeakerIndex].Volume = Volume;
+        Speakers[SpeakerIndex].LastReportSeconds = ReportSeconds;
+    }
+    LastReport.Add({ RoomIndex, SpeakerIndex });
+}
+
+void FRtcSpeakerTable::EndReport()
+{
+    // Exponential smoothing over the time between reports, so the result does not depend on the report interval
+    const double DeltaSeconds = ReportSeconds - PreviousReportSeconds;
+    const float Alpha = SmoothingTimeSeconds > 0.f && PreviousReportSeconds > 0.0 && DeltaSeconds >= 0.0
+        ? 1.f - FMath::Exp(-(float)DeltaSeconds / SmoothingTimeSeconds)
+        : 1.f;
+    for (FRoom& Room : Rooms)
+    {
+        for (FSpeaker& Speaker : Room.Speakers)
+        {
+            const float Target = Speaker.LastReportSeconds == ReportSeconds ? (float)Speaker.Volume : 0.f;
+            Speaker.SmoothedVolume += (Target - Speaker.SmoothedVolume) * Alpha;
+        }
+    }
+    PreviousReportSeconds = ReportSeconds;
+}
+
+static void CopyIdIfChanged(FString& Out, const FString& Id)
+{
+    // Assigning an equal ID would still reallocate when the lengths differ, comparing first keeps steady reports allocation free
+    if (!Out.Equals(Id, ESearchCase::CaseSensitive))
+    {
+        Out = Id;
+    }
+}
+
+void FRtcSpeakerTable::CopyLastReport(TArray<int>& OutVolumes, TArray<FString>& OutRoomIds, TArray<FString>& OutUserIds, TArray<ERtcStreamIndex>& OutStreamIndices) const
+{
+    const int32 NumEntries = LastReport.Num();
+    OutVolumes.SetNum(NumEntries, false);
+    OutRoomIds.SetNum(NumEntries, false);
+    OutUserIds.SetNum(NumEntries, false);
+    OutStreamIndices.SetNum(NumEntries, false);
+    for (int32 Index = 0; Index < NumEntries; ++Index)
+    {
+        const FRoom& Room = Rooms[LastReport[Index].RoomIndex];
+        const FSpeaker& Speaker = Room.Speakers[LastReport[Index].SpeakerIndex];
+        OutVolumes[Index] = Speaker.Volume;
+        CopyIdIfChanged(OutRoomIds[Index], Ids.GetId(Room.RoomHandle));
+        CopyIdIfChanged(OutUserIds[Index], Ids.GetId(Speaker.UserHandle));
+        OutStreamIndices[Index] = Speaker.StreamIndex;
+    }
+}
+
+void FRtcSpeakerTable::RemoveRoom(const FString& RoomId)
+{
+    const int32 RoomIndex = FindRoomIndex(Ids.Find(RoomId));
+    if (RoomIndex != INDEX_NONE)
+    {
+        Rooms.RemoveAtSwap(RoomIndex);
+        LastReport.Reset();
+    }
+}
+
+void FRtcSpeakerTable::RemoveUser(const FString& RoomId, const FString& UserId)
+{
+    const int32 RoomIndex = FindRoomIndex(Ids.Find(RoomId));
+    const int32 UserHandle = Ids.Find(UserId);
+    if (RoomIndex != INDEX_NONE && UserHandle != INDEX_NONE)
+    {
+        Rooms[RoomIndex].Speakers.RemoveAllSwap([UserHandle](const FSpeaker& Speaker)
+        {
+            return Speaker.UserHandle == UserHandle;
+        });
+        LastReport.Reset();
+    }
+}
+
+void FRtcSpeakerTable::Reset()
+{
+    Rooms.Reset();
+    LastReport.Reset();
+    PreviousReportSeconds = 0.0;
+}
+
+const FRtcSpeakerTable::FRoom* FRtcSpeakerTable::FindRoom(const FString& RoomId) const
+{
+    const int32 RoomIndex = FindRoomIndex(Ids.Find(RoomId));
+    return RoomIndex != INDEX_NONE ? &Rooms[RoomIndex] : nullptr;
+}
+
+float FRtcSpeakerTable::GetSmoothedVolume(const FString& RoomId, const FString& UserId) const
+{
+    const FRoom* Room = FindRoom(RoomId);
+    const int32 UserHandle = Ids.Find(UserId);
+    float Volume = 0.f;
+    if (Room && UserHandle != INDEX_NONE)
+    {
+        for (const FSpeaker& Speaker : Room->Speakers)
+        {
+            if (Speaker.UserHandle == UserHandle)
+            {
+                Volume = FMath::Max(Volume, Speaker.SmoothedVolume);
+            }
+        }
+    }
+    return Volume;
+}
+
+int32 FRtcSpeakerTable::GetTopSpeakers(const FString& RoomId, int32 MaxSpeakers, float MinVolume, TArray<const FSpeaker*>& OutSpeakers) const
+{
+    OutSpeakers.Reset();
+    const FRoom* Room = FindRoom(RoomId);
+    if (!Room || MaxSpeakers <= 0)
+    {
+        return 0;
+    }
+
+    // Insertion into a list capped at MaxSpeakers, rooms are small and this keeps a reused array from allocating
+    OutSpeakers.Reserve(MaxSpeakers);
+    for (const FSpeaker& Speaker : Room->Speakers)
+    {
+        if (Speaker.SmoothedVolume < MinVolume)
+        {
+            continue;
+        }
+        int32 InsertIndex = OutSpeakers.Num();
+        while (InsertIndex > 0 && OutSpeakers[InsertIndex - 1]->SmoothedVolume < Speaker.SmoothedVolume)
+        {
+            --InsertIndex;
+        }
+        if (InsertIndex < MaxSpeakers)
+        {
+            if (OutSpeakers.Num() == MaxSpeakers)
+            {
+                OutSpeakers.Pop(false);
+            }
+            OutSpeakers.Insert(&Speaker, InsertIndex);
+        }
+    }
+    return OutSpeakers.Num();
+}
+
+int32 FRtcSpeakerTable::FindRoomIndex(int32 RoomHandle) const
+{
+    if (RoomHandle == INDEX_NONE)
+    {
+        return INDEX_NONE;
+    }
+    return Rooms.IndexOfByPredicate([RoomHandle](const FRoom& Room)
+    {
+        return Room.RoomHandle == RoomHandle;
+    });
+}
@@ -0,0 +1,249 @@
+// Copyright 2022 Pico Technology Co., Ltd.All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc.In the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "PicoOnlineBenchmark.h"
+#include "RTCPicoUserInterface.h"
+#include "RtcSpeakerTable.h"
+
+// Replays synthetic remote audio properties reports through the speaker table and through the per-report arrays the
+// report handler used to build. Needs no device or RTC engine, so it runs on Linux too. Afterwards the reports are replayed
+// once more, untimed, and every copied report, the smoothed volumes and the top speakers are checked against a reference.
+
+namespace RtcSpeakerTableBenchmark
+{
+    /** One entry of a synthetic report, IDs as the SDK hands them out */
+    struct FSyntheticEntry
+    {
+        const ANSICHAR* RoomId;
+        const ANSICHAR* UserId;
+        ERtcStreamIndex StreamIndex;
+        int32 Volume;
+    };
+
+    /** One stream as the speaker table documents it, updated the obvious way */
+    struct FReferenceSpeaker
+    {
+        FString RoomId;
+        FString UserId;
+        int32 Volume;
+        float SmoothedVolume;
+        double LastReportSeconds;
+    };
+
+    static void Verify(const TArray<TArray<FSyntheticEntry>>& Reports, double IntervalSeconds, float SmoothingSeconds, const FString& RoomId,
+        int32 TopCount, float MinVolume, FPicoOnlineBenchmark& Benchmark)
+    {
+        FRtcIdTable Ids;
+        FRtcSpeakerTable Table(Ids);
+        Table.SetSmoothingTime(SmoothingSeconds);
+        TArray<int> Volumes;
+        TArray<FString> ReportRoomIds;
+        TArray<FString> ReportUserIds;
+        TArray<ERtcStreamIndex> StreamIndices;
+        // Keyed by room and user, every synthetic stream is the main one
+        TMap<FString, FReferenceSpeaker> Reference;
+        double NowSeconds = 1.0;
+        double PreviousSeconds = 0.0;
+        int32 NumBadReports = 0;
+        for (const TArray<FSyntheticEntry>& Report : Reports)
+        {
+            Table.BeginReport(NowSeconds);
+            for (const FSyntheticEntry& Entry : Report)
+            {
+                Table.AddReportEntry(Entry.RoomId, Entry.UserId, Entry.StreamIndex, Entry.Volume);
+            }
+            Table.EndReport();
+            Table.CopyLastReport(Volumes, ReportRoomIds, ReportUserIds, StreamIndices);
+
+            // What the handler used to broadcast, element by element
+            bool bReportMatches = Volumes.Num() == Report.Num() && ReportRoomIds.Num() == Report.Num()
+                && ReportUserIds.Num() == Report.Num() && StreamIndices.Num() == Report.Num();
+            for (int32 Index = 0; bReportMatches && Index < Report.Num(); Index++)
+            {
+                const FSyntheticEntry& Entry = Report[Index];
+                bReportMatches = Volumes[Index] == Entry.Volume
+                    && ReportRoomIds[Index].Equals(UTF8_TO_TCHAR(Entry.RoomId), ESearchCase::CaseSensitive)
+                    && ReportUserIds[Index].Equals(UTF8_TO_TCHAR(Entry.UserId), ESearchCase::CaseSensitive)
+                    && StreamIndices[Index] == Entry.StreamIndex;
+            }
+            NumBadReports += bReportMatches ? 0 : 1;
+
+            const float Alpha = SmoothingSeconds > 0.f && PreviousSeconds > 0.0
+                ? 1.f - FMath::Exp(-(float)(NowSeconds - PreviousSeconds) / SmoothingSeconds)
+                : 1.f;
+            for (const FSyntheticEntry& Entry : Report)
+            {
+                const FString RoomIdString = UTF8_TO_TCHAR(Entry.RoomId);
+                const FString UserIdString = UTF8_TO_TCHAR(Entry.UserId);
+                FReferenceSpeaker* Speaker = Reference.Find(RoomIdString + TEXT("/") + UserIdString);
+                if (Speaker)
+                {
+                    Speaker->Volume = Entry.Volume;
+                    Speaker->LastReportSeconds = NowSeconds;
+                }
+                else
+                {
+                    Reference.Add(RoomIdString + TEXT("/") + UserIdString, { RoomIdString, UserIdString, Entry.Volume, (float)Entry.Volume, NowSeconds });
+                }
+            }
+            for (TPair<FString, FReferenceSpeaker>& Pair : Reference)
+            {
+                FReferenceSpeaker& Speaker = Pair.Value;
+                const float Target = Speaker.LastReportSeconds == NowSeconds ? (float)Speaker.Volume : 0.f;
+                Speaker.SmoothedVolume += (Target - Speaker.SmoothedVolume) * Alpha;
+            }
+            PreviousSeconds = NowSeconds;
+            NowSeconds += IntervalSeconds;
+        }
+        Benchmark.Check(NumBadReports == 0, TEXT("%d of %d reports were copied out with other volumes, IDs or stream indices"), NumBadReports, Reports.Num());
+
+        float MaxSmoothingError = 0.f;
+        TArray<const FReferenceSpeaker*> ExpectedTop;
+        for (const TPair<FString, FReferenceSpeaker>& Pair : Reference)
+        {
+            const FReferenceSpeaker& Speaker = Pair.Value;
+            MaxSmoothingError = FMath::Max(MaxSmoothingError, FMath::Abs(Table.GetSmoothedVolume(Speaker.RoomId, Speaker.UserId) - Speaker.SmoothedVolume));
+            if (Speaker.RoomId == RoomId && Speaker.SmoothedVolume >= MinVolume)
+            {
+                ExpectedTop.Add(&Speaker);
+            }
+        }
+        Benchmark.Check(MaxSmoothingError <= 0.01f, TEXT("smoothed volumes differ from the reference by up to %g"), MaxSmoothingError);
+
+        // Sorting every stream of the room, loudest first
+        ExpectedTop.Sort([](const FReferenceSpeaker& A, const FReferenceSpeaker& B) { return A.SmoothedVolume > B.SmoothedVolume; });
+        ExpectedTop.SetNum(FMath::Min(ExpectedTop.Num(), FMath::Max(TopCount, 0)));
+        TArray<const FRtcSpeakerTable::FSpeaker*> TopSpeakers;
+        Table.GetTopSpeakers(RoomId, TopCount, MinVolume, TopSpeakers);
+        bool bTopMatches = TopSpeakers.Num() == ExpectedTop.Num();
+        for (int32 Index = 0; bTopMatches && Index < TopSpeakers.Num(); Index++)
+        {
+            bTopMatches = Ids.GetId(TopSpeakers[Index]->UserHandle).Equals(ExpectedTop[Index]->UserId, ESearchCase::CaseSensitive);
+        }
+        Benchmark.Check(bTopMatches, TEXT("top %d speakers of %s are not the %d loudest streams in order"), TopCount, *RoomId, ExpectedTop.Num());
+    }
+
+    static void Execute(const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+    {
+        FPicoOnlineBenchmark Benchmark(TEXT("pico.Rtc.BenchmarkSpeakerTable"), Args, Ar);
+        const int32 NumUsers = FMath::Max(Benchmark.Param(TEXT("Users="), 16), 1);
+        const int32 NumRooms = FMath::Max(Benchmark.Param(TEXT("Rooms="), 1), 1);
+        const int32 NumReports = FMath::Max(Benchmark.Param(TEXT("Reports="), 20000), 1);
+        const int32 IntervalMs = FMath::Max(Benchmark.Param(TEXT("IntervalMs="), 100), 1);
+        const int32 TopCount = Benchmark.Param(TEXT("Top="), 4);
+        const float SmoothingSeconds = Benchmark.Param(TEXT("Smoothing="), 0.3f);
+        const float MinVolume = 30.f;
+
+        // IDs shaped like the platform's, stored UTF-8 like the SDK returns them
+        TArray<TArray<ANSICHAR>> RoomIds;
+        TArray<TArray<ANSICHAR>> UserIds;
+        for (int32 Index = 0; Index < NumRooms; Index++)
+        {
+            const FString Id = FString::Printf(TEXT("room_%08x"), 0x52544300 + Index);
+            RoomIds.Emplace_GetRef().Append(TCHAR_TO_UTF8(*Id), Id.Len() + 1);
+        }
+        for (int32 Index = 0; Index < NumUsers; Index++)
+        {
+            const FString Id = FString::Printf(TEXT("%016llx"), 0x7069636f00000000ull + Index * 7919ull);
+            UserIds.Emplace_GetRef().Append(TCHAR_TO_UTF8(*Id), Id.Len() + 1);
+        }
+
+        // Every user is in every room, each report skips the silent ones like the SDK does and a few users talk at a time
+        FRandomStream Random(0x52544353);
+        TArray<TArray<FSyntheticEntry>> Reports;
+        Reports.SetNum(NumReports);
+        for (TArray<FSyntheticEntry>& Report : Reports)
+        {
+            for (int32 RoomIndex = 0; RoomIndex < NumRooms; RoomIndex++)
+            {
+                for (int32 UserIndex = 0; UserIndex < NumUsers; UserIndex++)
+                {
+                    const bool bTalking = Random.FRand() < 0.25f;
+                    if (bTalking || Random.FRand() < 0.5f)
+                    {
+                        const int32 Volume = bTalking ? Random.RandRange(60, 255) : Random.RandRange(0, 20);
+                        Report.Add({ RoomIds[RoomIndex].GetData(), UserIds[UserIndex].GetData(), ERtcStreamIndex::Main, Volume });
+                    }
+                }
+            }
+        }
+
+        // What the report handler used to do: four fresh arrays and two conversions per entry
+        int64 NumEntries = 0;
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        for (const TArray<FSyntheticEntry>& Report : Reports)
+        {
+            TArray<FString> RoomIdArray;
+            TArray<FString> UserIdArray;
+            TArray<ERtcStreamIndex> StreamIndexArray;
+            TArray<int> VolumeArray;
+            for (const FSyntheticEntry& Entry : Report)
+            {
+                VolumeArray.Add(Entry.Volume);
+                RoomIdArray.Add(UTF8_TO_TCHAR(Entry.RoomId));
+                UserIdArray.Add(UTF8_TO_TCHAR(Entry.UserId));
+                StreamIndexArray.Add(Entry.StreamIndex);
+            }
+            NumEntries += VolumeArray.Num() + RoomIdArray.Num() + UserIdArray.Num() + StreamIndexArray.Num();
+        }
+        const uint64 ArraysCycles = FPlatformTime::Cycles64() - StartCycles;
+
+        FRtcIdTable Ids;
+        FRtcSpeakerTable Table(Ids);
+        Table.SetSmoothingTime(SmoothingSeconds);
+        TArray<int> Volumes;
+        TArray<FString> ReportRoomIds;
+        TArray<FString> ReportUserIds;
+        TArray<ERtcStreamIndex> StreamIndices;
+        double NowSeconds = 1.0;
+        StartCycles = FPlatformTime::Cycles64();
+        for (const TArray<FSyntheticEntry>& Report : Reports)
+        {
+            Table.BeginReport(NowSeconds);
+            for (const FSyntheticEntry& Entry : Report)
+            {
+                Table.AddReportEntry(Entry.RoomId, Entry.UserId, Entry.StreamIndex, Entry.Volume);
+            }
+            Table.EndReport();
+            Table.CopyLastReport(Volumes, ReportRoomIds, ReportUserIds, StreamIndices);
+            NowSeconds += IntervalMs / 1000.0;
+        }
+        const uint64 TableCycles = FPlatformTime::Cycles64() - StartCycles;
+
+        const FString FirstRoomId = UTF8_TO_TCHAR(RoomIds[0].GetData());
+        TArray<const FRtcSpeakerTable::FSpeaker*> TopSpeakers;
+        StartCycles = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < NumReports; Index++)
+        {
+            Table.GetTopSpeakers(FirstRoomId, TopCount, MinVolume, TopSpeakers);
+        }
+        const uint64 TopCycles = FPlatformTime::Cycles64() - StartCycles;
+
+        Ar.Logf(TEXT("PICO RTC speaker table benchmark: %d rooms, %d users, %d reports every %d ms, %.1f entries per report"),
+            NumRooms, NumUsers, NumReports, IntervalMs, NumEntries / 4.0 / NumReports);
+        Benchmark.BeginTable(FPicoOnlineBenchmark::EUnit::Nanoseconds);
+        Benchmark.Row(TEXT("fresh arrays"), ArraysCycles, NumReports);
+        Benchmark.Row(TEXT("speaker table"), TableCycles, NumReports);
+        Benchmark.Row(*FString::Printf(TEXT("top %d speakers"), TopCount), TopCycles, NumReports);
+        for (const FRtcSpeakerTable::FSpeaker* Speaker : TopSpeakers)
+        {
+            Ar.Logf(TEXT("  %s smoothed volume %.1f"), *Ids.GetId(Speaker->UserHandle), Speaker->SmoothedVolume);
+        }
+        Verify(Reports, IntervalMs / 1000.0, SmoothingSeconds, FirstRoomId, TopCount, MinVolume, Benchmark);
+        Benchmark.Finish();
+    }
+
+    static FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchmarkCommand(
+        TEXT("pico.Rtc.BenchmarkSpeakerTable"),
+        TEXT("Replays synthetic remote audio properties reports through the speaker table and through fresh per-report arrays, reports CPU time per report and fails when the table's reports, smoothed volumes or top speakers are wrong.\n")
+        TEXT("Params: Users= Rooms= Reports= IntervalMs= Top= Smoothing="),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Execute));
+}
+
+#endif
@@ -135,6 +135,28 @@ private:
 
     TMap<uint64, FOnlineAsyncTaskPico*> RequestTaskMap;
 
+    /** Dispatch order of popped messages, realtime (RTC notifications) first and bulk (leaderboards, asset files) last */
+    enum class EMessageLane : uint8
+    {
+        Realtime,
+        Default,
+        Bulk,
+        Num
+    };
+
+    struct FPendingMessage
+    {
+        ppfMessageHandle MessageHandle;
+        double ReceivedTime;
+    };
+
+    /** Messages popped from the platform but not dispatched yet, because the tick budget ran out */
+    TArray<FPendingMessage> PendingMessages[static_cast<int32>(EMessageLane::Num)];
+
+    static EMessageLane GetMessageLane(ppfMessageType MessageType);
+
+    void DispatchMessage(ppfMessageHandle MessageHandle);
+
 protected:
 
     /** Cached reference to the main online subsystem */
@@ -145,9 +167,7 @@ public:
     {
     }
 
-    ~FOnlineAsyncTaskManagerPico()
-    {
-    }
+    ~FOnlineAsyncTaskManagerPico();
 
     // FOnlineAsyncTaskManager
     virtual void OnlineTick() override;
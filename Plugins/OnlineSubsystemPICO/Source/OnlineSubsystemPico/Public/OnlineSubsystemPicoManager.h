@@ -229,7 +229,7 @@ public:
     void OnRtcAudioChangePlaybackDevice(ERtcAudioPlaybackDevice RtcAudioPlaybackDevice);
     void OnRtcMediaDeviceChangeInfo(const FString& DeviceId, ERtcMediaDeviceType MediaDeciveType, ERtcMediaDeviceState MediaDeviceState, ERtcMediaDeviceError MediaDeviceError);
     void OnRtcLocalAudioPropertiesReport(TArray<ERtcStreamIndex> StreamIndexs, TArray<int> Volumes);
-    void OnRtcRemoteAudioPropertiesReport(int TotalRemoteVolume, TArray<int> Volumes, const TArray<FString>& RoomIds, const TArray<FString>& UserIds, TArray<ERtcStreamIndex> StreamIndexs);
+    void OnRtcRemoteAudioPropertiesReport(int TotalRemoteVolume, const TArray<int>& Volumes, const TArray<FString>& RoomIds, const TArray<FString>& UserIds, const TArray<ERtcStreamIndex>& StreamIndexs);
     void OnRtcWarn(int MessageCode);
     void OnRtcError(int MessageCode);
     void OnRtcConnectStateChanged(const FString& StringMessage);
@@ -8,10 +8,9 @@
 #include "OnlineSubsystemPico.h"
 #include "OnlineSubsystemPicoPackage.h"
 #include "OnlineSubsystemPicoNames.h"
-#include <string>
-
-using namespace std;
-const string HEX = "0123456789abcdef";
+#include "RtcIdTable.h"
+#include "RtcBinaryPayloadPool.h"
+#include "RtcSpeakerTable.h"
 
 /// @file RTCPicoUserInterface.h
 
@@ -209,7 +208,7 @@ DECLARE_MULTICAST_DELEGATE_TwoParams(FRtcUserMuteAudioInfo, const FString& /*Use
 DECLARE_MULTICAST_DELEGATE_OneParam(FRtcAudioChangePlaybackDevice, ERtcAudioPlaybackDevice /*RtcAudioPlaybackDevice*/);
 DECLARE_MULTICAST_DELEGATE_FourParams(FRtcMediaDeviceChangeInfo, const FString& /*DeviceId*/, ERtcMediaDeviceType /*MediaDeciveType*/, ERtcMediaDeviceState /*MediaDeviceState*/, ERtcMediaDeviceError /*MediaDeviceError*/);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FRtcLocalAudioPropertiesReport, TArray<ERtcStreamIndex>  /*StreamIndex*/, TArray<int> /*Volume Array*/);
-DECLARE_MULTICAST_DELEGATE_FiveParams(FRtcRemoteAudioPropertiesReport, int /*TotalRemoteVolume*/, TArray<int> /*Volume Array*/, const TArray<FString>& /*RoomId Array*/, const TArray<FString>&  /*UserId Array*/, TArray<ERtcStreamIndex>  /*StreamIndex Array*/);
+DECLARE_MULTICAST_DELEGATE_FiveParams(FRtcRemoteAudioPropertiesReport, int /*TotalRemoteVolume*/, const TArray<int>& /*Volume Array*/, const TArray<FString>& /*RoomId Array*/, const TArray<FString>&  /*UserId Array*/, const TArray<ERtcStreamIndex>&  /*StreamIndex Array*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FRtcStringResult, const FString& /*MessageString*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FRtcIntResult, int /*MessageCode*/);
 
@@ -221,6 +220,8 @@ DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcMessageSendResult, int64 /*MessageId*
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcBinaryMessageReceived, const FString& /*RoomId*/, const FString& /*UserId*/, const FString& /*Info*/)
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcRoomMessageReceived, const FString& /*RoomId*/, const FString& /*UserId*/, const FString& /*Message*/)
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcUserMessageReceived, const FString& /*RoomId*/, const FString& /*UserId*/, const FString& /*Message*/)
+DECLARE_MULTICAST_DELEGATE_FiveParams(FGetRtcStreamSyncPayload, const FString& /*RoomId*/, const FString& /*UserId*/, ERtcStreamIndex /*StreamIndex*/, ERtcSyncInfoStreamType /*RtcSyncInfoStreamType*/, const FRtcBinaryPayloadRef& /*Payload*/)
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcBinaryPayloadReceived, const FString& /*RoomId*/, const FString& /*UserId*/, const FRtcBinaryPayloadRef& /*Payload*/)
 /** @addtogroup Function Function
  *  This is the Function group
  *  @{
@@ -444,6 +445,14 @@ public:
     /// </returns>
     int32 RtcSendStreamSyncInfo(int32 Info, ERtcStreamIndex InStreamIndex, int32 RepeatCount, ERtcSyncInfoStreamType InSyncInfoStreamType);
 
+    /// <summary>
+    /// Sends stream sync info as raw bytes, which are handed to the SDK without being converted or copied.
+    /// Remote users receive them through `RtcStreamSyncPayloadCallback`.
+    /// </summary>
+    /// <param name="Data">The sync info, up to 255 bytes.</param>
+    /// <returns>The same codes as the `int32` overload.</returns>
+    int32 RtcSendStreamSyncInfo(TArrayView<const uint8> Data, ERtcStreamIndex InStreamIndex, int32 RepeatCount, ERtcSyncInfoStreamType InSyncInfoStreamType);
+
     /// <summary>
     /// Publishes the local audio stream to a room so that the local user's voice can be heard by other users in the same room.
     /// @note
@@ -514,6 +523,15 @@ public:
     /// <returns>A user message ID of type int64, which is automatically generated and incremented.</returns>
     int64 RtcSendRoomBinaryMessage(const FString& RoomId, const FString& MessageInfo);
 
+    /// <summary>
+    /// Sends a binary message to a room as raw bytes, which are handed to the SDK without being converted or copied.
+    /// The room ID is converted once and cached. In-room users receive the message through `RtcBinaryPayloadReceivedCallback`.
+    /// </summary>
+    /// <param name="RoomId">The ID of the room to which the binary message is to be sent.</param>
+    /// <param name="Data">The binary message to be sent.</param>
+    /// <returns>A user message ID of type int64, which is automatically generated and incremented.</returns>
+    int64 RtcSendRoomBinaryMessage(const FString& RoomId, TArrayView<const uint8> Data);
+
     /// <summary>
     /// Sends a text message to a room. All in-room users will receive this message.
     /// </summary>
@@ -531,6 +549,16 @@ public:
     /// <returns>A user message ID of type int64, which is automatically generated and incremented.</returns>
     int64 RtcSendUserBinaryMessage(const FString& RoomId, const FString& UserId, const FString& MessageInfo);
 
+    /// <summary>
+    /// Sends a binary message to a user as raw bytes, which are handed to the SDK without being converted or copied.
+    /// The room and user IDs are converted once and cached.
+    /// </summary>
+    /// <param name="RoomId">The ID of the room the user is in.</param>
+    /// <param name="UserId">The ID of the user to whom the binary message is to be sent.</param>
+    /// <param name="Data">The binary message to be sent.</param>
+    /// <returns>A user message ID of type int64, which is automatically generated and incremented.</returns>
+    int64 RtcSendUserBinaryMessage(const FString& RoomId, const FString& UserId, TArrayView<const uint8> Data);
+
     /// <summary>
     /// Sends a text message to a user. Only the user can receive this message.
     /// </summary>
@@ -541,7 +569,17 @@ public:
     int64 RtcSendUserMessage(const FString& RoomId, const FString& UserId, const FString& Message);
 
 private:
-    TArray<uint8> GetBytesByInt(int32 Inint);
+    /** Writes Inint big-endian without leading zero bytes into OutBytes, which holds 4 bytes, and returns the number written */
+    static int32 GetBytesByInt(int32 Inint, uint8* OutBytes);
+
+    /** Room and user IDs seen by the RTC interface, converted to UTF-8 once */
+    FRtcIdTable RtcIds;
+
+    /** Buffers for received binary messages and stream sync info */
+    FRtcBinaryPayloadPool ReceivedPayloads;
+
+    /** Bytes of the last string sent as a binary message, reused across sends */
+    TArray<uint8> StringMessageBytes;
 
 
 PACKAGE_SCOPE:
@@ -594,6 +632,14 @@ PACKAGE_SCOPE:
     FDelegateHandle OnRemoteAudioPropertiesReportNotificationHandle;
     void OnRemoteAudioPropertiesReportNotification(ppfMessageHandle Message, bool bIsError);
 
+    /** Remote speakers updated from the audio properties reports, refers to RtcIds */
+    FRtcSpeakerTable RemoteSpeakers;
+    /** Broadcast arguments of the last report, reused across reports */
+    TArray<int> RemoteReportVolumes;
+    TArray<FString> RemoteReportRoomIds;
+    TArray<FString> RemoteReportUserIds;
+    TArray<ERtcStreamIndex> RemoteReportStreamIndices;
+
     FDelegateHandle OnLocalAudioPropertiesReportNotificationHandle;
     void OnLocalAudioPropertiesReportNotification(ppfMessageHandle Message, bool bIsError);
 
@@ -656,8 +702,13 @@ public:
     FRtcAudioChangePlaybackDevice RtcAudioPlaybackDeviceChangeCallback;
 
     /// <summary>Gets the volume of each user's voice.</summary>
+    /// The arrays are reused across reports, copy them to keep them past the callback.
     FRtcRemoteAudioPropertiesReport RtcRemoteAudioPropertiesReportCallback;
 
+    /// <summary>Gets the remote speakers of the rooms the user is in, with their smoothed volumes.</summary>
+    /// Updated from the remote audio properties reports, enable them with `RtcEnableAudioPropertiesReport`.
+    const FRtcSpeakerTable& GetRemoteSpeakers() const { return RemoteSpeakers; }
+
     /// <summary>Gets the volume of the current user's voice.</summary>
     FRtcLocalAudioPropertiesReport RtcLocalAudioPropertiesReportCallback;
 
@@ -700,6 +751,11 @@ public:
     /// </summary>
     FGetRtcStreamSyncInfo RtcStreamSyncInfoCallback;
 
+    /// <summary>
+    /// Sets the callback to get the bytes of received stream sync info, without a string conversion.
+    /// </summary>
+    FGetRtcStreamSyncPayload RtcStreamSyncPayloadCallback;
+
     /// <summary>
     /// Sets the callback to get whether the to-room or to-user message is sent successfully.
     /// </summary>
@@ -710,6 +766,11 @@ public:
     /// </summary>
     FRtcBinaryMessageReceived RtcBinaryMessageReceivedCallback;
 
+    /// <summary>
+    /// Sets the callback to get the bytes of a received to-room or to-user binary message, without a string conversion.
+    /// </summary>
+    FRtcBinaryPayloadReceived RtcBinaryPayloadReceivedCallback;
+
     /// <summary>
     /// Sets the callback to get notified when a to-room message is received.
     /// </summary>
@@ -0,0 +1,34 @@
+// Copyright 2022 Pico Technology Co., Ltd.All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc.In the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Bytes of a received RTC binary message or stream sync info */
+struct FRtcBinaryPayload
+{
+    TArray<uint8> Data;
+};
+
+/** Listeners may keep the reference past the callback, the buffer goes back to its pool once the last one is dropped */
+typedef TSharedRef<const FRtcBinaryPayload, ESPMode::ThreadSafe> FRtcBinaryPayloadRef;
+
+/**
+ * Buffers for received RTC payloads. The SDK's copy only lives while its notification is handled, each payload is copied
+ * once into a buffer that already has the capacity, instead of into a fresh array or a string.
+ */
+class ONLINESUBSYSTEMPICO_API FRtcBinaryPayloadPool
+{
+public:
+    /** Returns a free buffer holding a copy of the bytes */
+    FRtcBinaryPayloadRef Acquire(const uint8* Data, int32 NumBytes);
+
+    int32 Num() const { return Payloads.Num(); }
+
+    void Reset() { Payloads.Reset(); }
+
+private:
+    TArray<TSharedRef<FRtcBinaryPayload, ESPMode::ThreadSafe>> Payloads;
+};
@@ -0,0 +1,54 @@
+// Copyright 2022 Pico Technology Co., Ltd.All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc.In the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * RTC room and user IDs, interned once in both encodings. IDs coming from the SDK are matched by their UTF-8 bytes
+ * and IDs coming from game code by their characters, so neither side converts an ID it has seen before.
+ * References returned by GetId and GetUTF8Id stay valid while more IDs are interned, until the table is reset.
+ */
+class ONLINESUBSYSTEMPICO_API FRtcIdTable
+{
+public:
+    /** Returns the handle of the ID, interning it on first use */
+    int32 Intern(const ANSICHAR* UTF8Id);
+    int32 Intern(const FString& Id);
+
+    int32 Find(const ANSICHAR* UTF8Id) const;
+    int32 Find(const FString& Id) const;
+
+    const FString& GetId(int32 Handle) const;
+
+    /** Null-terminated UTF-8 ID, or nullptr for an invalid handle */
+    const ANSICHAR* GetUTF8Id(int32 Handle) const
+    {
+        return Ids.IsValidIndex(Handle) ? Ids[Handle]->UTF8Id.GetData() : nullptr;
+    }
+
+    int32 Num() const { return Ids.Num(); }
+
+    /** Forgets every ID, invalidating all handles and references into the table */
+    void Reset();
+
+private:
+    struct FInternedId
+    {
+        FString Id;
+        uint32 Hash;
+        /** Null-terminated UTF-8 copy of Id */
+        TArray<ANSICHAR> UTF8Id;
+        uint32 UTF8Hash;
+    };
+
+    int32 Add(FString&& Id, const ANSICHAR* UTF8Id);
+
+    /** Interned IDs, indexed by handle. Entries are allocated one by one so growing the array does not move them */
+    TArray<TUniquePtr<FInternedId>> Ids;
+    /** Handles by the CRC of the characters and of the UTF-8 bytes, colliding IDs share a key */
+    TMultiMap<uint32, int32> HandlesByHash;
+    TMultiMap<uint32, int32> HandlesByUTF8Hash;
+};
@@ -0,0 +1,92 @@
+// Copyright 2022 Pico Technology Co., Ltd.All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc.In the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc.All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RtcIdTable.h"
+
+enum class ERtcStreamIndex : uint8;
+
+/**
+ * Remote speakers of the RTC rooms the user is in, updated in place from the remote audio properties reports.
+ * Room and user IDs are interned in a shared ID table the first time a report carries them, later reports match
+ * their UTF-8 bytes against the interned IDs, so applying a report of known speakers neither converts nor allocates.
+ */
+class ONLINESUBSYSTEMPICO_API FRtcSpeakerTable
+{
+public:
+    /** One audio stream of a remote user */
+    struct FSpeaker
+    {
+        int32 UserHandle;
+        ERtcStreamIndex StreamIndex;
+        /** Volume of the last report that carried this stream, 0 to 255 */
+        int32 Volume;
+        /** Volume smoothed over the smoothing time, decays towards 0 while the stream is missing from the reports */
+        float SmoothedVolume;
+        /** Receive time of the last report that carried this stream */
+        double LastReportSeconds;
+    };
+
+    struct FRoom
+    {
+        int32 RoomHandle;
+        TArray<FSpeaker> Speakers;
+    };
+
+    explicit FRtcSpeakerTable(FRtcIdTable& InIds);
+
+    /** Time constant of the volume smoothing, 0 to follow the reports unsmoothed */
+    void SetSmoothingTime(float Seconds) { SmoothingTimeSeconds = FMath::Max(Seconds, 0.f); }
+
+    /** Table the room and user handles refer to */
+    const FRtcIdTable& GetIds() const { return Ids; }
+
+    /** Starts applying a report received at NowSeconds */
+    void BeginReport(double NowSeconds);
+    void AddReportEntry(const ANSICHAR* UTF8RoomId, const ANSICHAR* UTF8UserId, ERtcStreamIndex StreamIndex, int32 Volume);
+    /** Smooths the volumes, streams missing from the report count as silent */
+    void EndReport();
+
+    /**
+     * Copies the entries of the last report into the arrays the report delegate broadcasts, in report order.
+     * Reused arrays only reallocate when a report carries more entries or a different ID than before.
+     */
+    void CopyLastReport(TArray<int>& OutVolumes, TArray<FString>& OutRoomIds, TArray<FString>& OutUserIds, TArray<ERtcStreamIndex>& OutStreamIndices) const;
+
+    void RemoveRoom(const FString& RoomId);
+    void RemoveUser(const FString& RoomId, const FString& UserId);
+    void Reset();
+
+    int32 NumRooms() const { return Rooms.Num(); }
+    const FRoom* FindRoom(const FString& RoomId) const;
+
+    /** Smoothed volume of the user's loudest stream in the room, 0 for an unknown user */
+    float GetSmoothedVolume(const FString& RoomId, const FString& UserId) const;
+
+    /**
+     * Replaces the contents of OutSpeakers with up to MaxSpeakers streams of the room whose smoothed volume is at
+     * least MinVolume, loudest first. The pointers are valid until the table is next changed.
+     */
+    int32 GetTopSpeakers(const FString& RoomId, int32 MaxSpeakers, float MinVolume, TArray<const FSpeaker*>& OutSpeakers) const;
+
+private:
+    /** Position of a report entry in the table */
+    struct FReportEntry
+    {
+        int32 RoomIndex;
+        int32 SpeakerIndex;
+    };
+
+    int32 FindRoomIndex(int32 RoomHandle) const;
+
+    FRtcIdTable& Ids;
+    TArray<FRoom> Rooms;
+    /** Entries of the last report in report order, cleared when rooms or users are removed */
+    TArray<FReportEntry> LastReport;
+    double ReportSeconds;
+    double PreviousReportSeconds;
+    float SmoothingTimeSeconds;
+};
@@ -3,10 +3,25 @@
 
 #include "PXR_DP.h"
 #include "D3D11RHIPrivate.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
 #include "PXR_Log.h"
 
+static TAutoConsoleVariable<int32> CVarFrameProtocol(
+	TEXT("vr.PICO.DP.FrameProtocol"),
+	0,
+	TEXT("Encoding of the per-frame eye layer submission sent to the PICO runtime.\n")
+	TEXT(" 0: string parameters, the format the current runtime parses (default)\n")
+	TEXT(" 1: versioned binary frame message in a single parameter, for runtimes that understand it"),
+	ECVF_Default);
+
 DP::DP()
 {
+	SubmitMessage.SetType_(TerminalMessage::Type::kSubmitEyeLayer);
+	BinaryFrameParameters.resize(1);
+	BinaryFrameParameters[0].describe = PXRDPFrameMessage::ParameterDescribe;
+	BinaryFrameParameters[0].type = TerminalMessage::Parameter::Type::kString;
+
 	PXR_LOGD(PxrUnreal,"PXR_DP Construct!");
 	PXR_LOGD(PxrUnreal,"PXR_DP ConnectServer!");
 	ConnectServer();
@@ -106,68 +121,43 @@ void DP::SendMessage()
 	}
 	uint32 LeftHandle = HandleToULong(LeftDstTextureHandle);
 	uint32 RightHandle = HandleToULong(RightDstTextureHandle);
-	pxr::p_uint64 left_eye_handle = LeftHandle;
-	pxr::p_uint64 right_eye_handle = RightHandle;
-
-	TerminalMessage submit_message;
-	submit_message.SetType_(TerminalMessage::Type::kSubmitEyeLayer);
-	submit_message.SetDestinationTerminalId(local_runtime_id_);
-
-	std::vector<TerminalMessage::Parameter> parameters;
-	TerminalMessage::Parameter parameter;
 
 	FVector position = FVector::ZeroVector;
 	FQuat rotation = FQuat::Identity;
 	GetPositionAndRotation(position, rotation);
+	const float HalfFovTangent = FPlatformMath::Tan(FMath::DegreesToRadians(DirectPreviewFov) / 2.f);
+
+	FPXRDPFrameSubmission Frame;
+	Frame.TimestampNs = (uint64)(FPlatformTime::Seconds() * 1000000000.0);
+	Frame.FrameNumber = SubmittedFrameCount++;
+	Frame.LeftEyeHandle = LeftHandle;
+	Frame.RightEyeHandle = RightHandle;
+	Frame.Rotation[0] = rotation.X;
+	Frame.Rotation[1] = rotation.Y;
+	Frame.Rotation[2] = rotation.Z;
+	Frame.Rotation[3] = -rotation.W;
+	Frame.Position[0] = position.X;
+	Frame.Position[1] = position.Y;
+	Frame.Position[2] = position.Z;
+	Frame.FovTangents[0] = -HalfFovTangent;
+	Frame.FovTangents[1] = HalfFovTangent;
+	Frame.FovTangents[2] = HalfFovTangent;
+	Frame.FovTangents[3] = -HalfFovTangent;
+
+	SubmitMessage.SetDestinationTerminalId(local_runtime_id_);
+	if (CVarFrameProtocol.GetValueOnAnyThread() == 1)
+	{
+		uint8 EncodedFrame[PXRDPFrameMessage::EncodedSize];
+		const int32 NumBytes = PXRDPFrameMessage::Encode(Frame, EncodedFrame);
+		BinaryFrameParameters[0].parameter.assign(reinterpret_cast<const char*>(EncodedFrame), NumBytes);
+		SubmitMessage.SetParameters(BinaryFrameParameters);
+	}
+	else
+	{
+		SubmitMessage.SetParameters(LegacyFrameEncoder.Encode(Frame));
+	}
 
-	parameter.describe = "rotation_x";
-	parameter.parameter = std::to_string(rotation.X);
-	parameter.type = TerminalMessage::Parameter::Type::kFloat;
-	parameters.push_back(parameter);
-
-	parameter.describe = "rotation_y";
-	parameter.parameter = std::to_string(rotation.Y);
-	parameter.type = TerminalMessage::Parameter::Type::kFloat;
-	parameters.push_back(parameter);
-
-	parameter.describe = "rotation_z";
-	parameter.parameter = std::to_string(rotation.Z);
-	parameter.type = TerminalMessage::Parameter::Type::kFloat;
-	parameters.push_back(parameter);
-
-	parameter.describe = "rotation_w";
-	parameter.parameter = std::to_string(-rotation.W);
-	parameter.type = TerminalMessage::Parameter::Type::kFloat;
-	parameters.push_back(parameter);
-
-	parameter.describe = "position_x";
-	parameter.parameter = std::to_string(position.X);
-	parameter.type = TerminalMessage::Parameter::Type::kFloat;
-	parameters.push_back(parameter);
-
-	parameter.describe = "position_y";
-	parameter.parameter = std::to_string(position.Y);
-	parameter.type = TerminalMessage::Parameter::Type::kFloat;
-	parameters.push_back(parameter);
-
-	parameter.describe = "position_z";
-	parameter.parameter = std::to_string(position.Z);
-	parameter.type = TerminalMessage::Parameter::Type::kFloat;
-	parameters.push_back(parameter);
-
-	parameter.describe = "left_eye";
-	parameter.parameter = std::to_string(left_eye_handle);
-	parameter.type = TerminalMessage::Parameter::Type::kUInt64;
-	parameters.push_back(parameter);
-
-	parameter.describe = "right_eye";
-	parameter.parameter = std::to_string(right_eye_handle);
-	parameter.type = TerminalMessage::Parameter::Type::kUInt64;
-	parameters.push_back(parameter);
-
-	submit_message.SetParameters(parameters);
-
-	pxr::IDPInterface::IResult res = terminal_->PushMessage(submit_message);
+	pxr::IDPInterface::IResult res = terminal_->PushMessage(SubmitMessage);
 }
 
 uint32 DP::GetHandle(ID3D11Texture2D& D3D11Texture2D)
@@ -290,19 +280,48 @@ void DP::GetPositionAndRotation(FVector& OutPostion, FQuat& OutQuat)
 	}
 }
 
+void DP::UpdateControllerSnapshot()
+{
+	FControllerSnapshot Snapshots[2];
+	if (terminal_)
+	{
+		for (int hand = 0; hand < 2; hand++)
+		{
+			pxr::connector::ControllerAccessory::Type handtype = (hand == 0 ? pxr::connector::ControllerAccessory::Type::kLeft : pxr::connector::ControllerAccessory::Type::kRight);
+			ControllerAccessory controller;
+			terminal_->QueryRemoteControllerAccessory(remote_hmd_id_, handtype, controller);
+
+			FControllerSnapshot& Snapshot = Snapshots[hand];
+			Snapshot.bActive = controller.GetIsActive_();
+			Snapshot.ButtonStatus = controller.GetButtonStatus_();
+			controller.GetPosition_(Snapshot.Position);
+			controller.GetRotation_(Snapshot.Rotation);
+			//Todo: X Y exchanged!
+			Snapshot.JoyStickX = controller.GetJoystickPosition_().y;
+			Snapshot.JoyStickY = controller.GetJoystickPosition_().x;
+			Snapshot.TriggerValue = controller.GetTriggerValue_();
+			Snapshot.GripValue = controller.GetGripValue_();
+		}
+	}
+
+	FScopeLock Lock(&ControllerSnapshotLock);
+	ControllerSnapshots[0] = Snapshots[0];
+	ControllerSnapshots[1] = Snapshots[1];
+}
+
+DP::FControllerSnapshot DP::GetControllerSnapshot(int hand) const
+{
+	FScopeLock Lock(&ControllerSnapshotLock);
+	return ControllerSnapshots[hand == 0 ? 0 : 1];
+}
+
 void DP::GetControllerPositionAndRotation(int hand, float WorldScale, FVector& OutPostion, FRotator& OutQuat)
 {
 	if (terminal_)
 	{
-		pxr::connector::ControllerAccessory::Type handtype = (hand == 0 ? pxr::connector::ControllerAccessory::Type::kLeft : pxr::connector::ControllerAccessory::Type::kRight);
-		TerminalAccessory ta;
-		PXR_OUT_VALUE ControllerAccessory out;
-		terminal_->QueryRemoteControllerAccessory(remote_hmd_id_, handtype, out);
-		
-		pxr::p_vector3_f position;
-		out.GetPosition_(position);
-		pxr::p_vector4_f rotation;
-		out.GetRotation_(rotation);
+		const FControllerSnapshot Snapshot = GetControllerSnapshot(hand);
+		const pxr::p_vector3_f& position = Snapshot.Position;
+		const pxr::p_vector4_f& rotation = Snapshot.Rotation;
 		OutPostion.X = -position.z;
 		OutPostion.Y = position.x;
 		OutPostion.Z = position.y;
@@ -320,10 +339,7 @@ bool DP::GetControllerConnectstatus(int hand)
 {
 	if (terminal_)
 	{
-		pxr::connector::ControllerAccessory::Type handtype = (hand == 0 ? pxr::connector::ControllerAccessory::Type::kLeft : pxr::connector::ControllerAccessory::Type::kRight);
-		ControllerAccessory controller;
-		terminal_->QueryRemoteControllerAccessory(remote_hmd_id_, handtype, controller);
-		return controller.GetIsActive_();
+		return GetControllerSnapshot(hand).bActive;
 	}
 	return false;
 }
@@ -332,10 +348,7 @@ uint16 DP::GetControllerButtonStatus(int hand)
 {
 	if (terminal_)
 	{
-		pxr::connector::ControllerAccessory::Type handtype = (hand == 0 ? pxr::connector::ControllerAccessory::Type::kLeft : pxr::connector::ControllerAccessory::Type::kRight);
-		ControllerAccessory controller;
-		terminal_->QueryRemoteControllerAccessory(remote_hmd_id_, handtype, controller);
-		return controller.GetButtonStatus_();
+		return GetControllerSnapshot(hand).ButtonStatus;
 	}
 	return uint16();
 }
@@ -344,16 +357,13 @@ void DP::GetControllerAxisValue(int hand, float& JoyStickX, float& JoyStickY, fl
 {
 	if (terminal_)
 	{
-		pxr::connector::ControllerAccessory::Type handtype = (hand == 0 ? pxr::connector::ControllerAccessory::Type::kLeft : pxr::connector::ControllerAccessory::Type::kRight);
-		ControllerAccessory controller;
-		terminal_->QueryRemoteControllerAccessory(remote_hmd_id_, handtype, controller);
-		if (controller.GetIsActive_())
+		const FControllerSnapshot Snapshot = GetControllerSnapshot(hand);
+		if (Snapshot.bActive)
 		{
-			//Todo: X Y exchanged!
-			JoyStickX = controller.GetJoystickPosition_().y;
-			JoyStickY = controller.GetJoystickPosition_().x;
-			TriggerValue = controller.GetTriggerValue_();
-			GripValue = controller.GetGripValue_();
+			JoyStickX = Snapshot.JoyStickX;
+			JoyStickY = Snapshot.JoyStickY;
+			TriggerValue = Snapshot.TriggerValue;
+			GripValue = Snapshot.GripValue;
 		}
 	}
 }
@@ -0,0 +1,111 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "PXR_DPEncodedFramePool.h"
+#include "PXR_Log.h"
+
+#if PLATFORM_WINDOWS
+DECLARE_STATS_GROUP(TEXT("PICOXRDirectPreview"), STATGROUP_PICOXRDP, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Encoded Frame Slabs"), STAT_PICOXRDPEncodedFrameSlabs, STATGROUP_PICOXRDP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Encoded Frames In Use (peak)"), STAT_PICOXRDPEncodedFramesPeakInUse, STATGROUP_PICOXRDP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Encoded Frame KB (peak)"), STAT_PICOXRDPEncodedFramePeakKB, STATGROUP_PICOXRDP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Encoded Frame Slab Grows"), STAT_PICOXRDPEncodedFrameGrows, STATGROUP_PICOXRDP);
+
+// A frame being encoded, one being sent and one queued behind it; more means a consumer is holding on to frames
+static const int32 PXR_DP_ENCODED_FRAME_POOL_WARN_SIZE = 6;
+
+FPXRDPEncodedFramePool::FPXRDPEncodedFramePool(int32 InSlabCapacity)
+	: SlabCapacity(FMath::Max(InSlabCapacity, 0))
+{
+}
+
+FPXRDPEncodedFramePtr FPXRDPEncodedFramePool::Acquire(pxr::p_size MinCapacity)
+{
+	FPXRDPEncodedFramePtr Result;
+	int32 NumInUse = 0;
+	for (const FPXRDPEncodedFramePtr& Frame : Frames)
+	{
+		if (!Frame.IsUnique())
+		{
+			NumInUse++;
+		}
+		else if (!Result.IsValid())
+		{
+			Result = Frame;
+		}
+	}
+
+	if (!Result.IsValid())
+	{
+		Result = MakeShareable(new FPXRDPEncodedFrame());
+		Result->Data.reserve(SlabCapacity);
+		Frames.Add(Result);
+		if (Frames.Num() > PXR_DP_ENCODED_FRAME_POOL_WARN_SIZE)
+		{
+			PXR_LOGI(PxrUnreal, "PXR_DP Encoded frame pool grew to %d", Frames.Num());
+		}
+	}
+
+	Result->Data.clear();
+	Result->FrameTag = nullptr;
+	if (Result->Data.capacity() < MinCapacity)
+	{
+		Result->Data.reserve(MinCapacity);
+		Stats.NumGrows++;
+		SET_DWORD_STAT(STAT_PICOXRDPEncodedFrameGrows, Stats.NumGrows);
+	}
+
+	Stats.NumAcquires++;
+	Stats.NumSlabs = Frames.Num();
+	Stats.NumInUse = NumInUse + 1;
+	Stats.PeakInUse = FMath::Max(Stats.PeakInUse, Stats.NumInUse);
+	SET_DWORD_STAT(STAT_PICOXRDPEncodedFrameSlabs, Stats.NumSlabs);
+	SET_DWORD_STAT(STAT_PICOXRDPEncodedFramesPeakInUse, Stats.PeakInUse);
+	return Result;
+}
+
+pxr::IDPInterface::IResult FPXRDPEncodedFramePool::AcquireFromEncoder(pxr::codec::EncoderInterface& Encoder, FPXRDPEncodedFramePtr& OutFrame)
+{
+	FPXRDPEncodedFramePtr Frame = Acquire();
+	const pxr::p_size CapacityBefore = Frame->Data.capacity();
+	const pxr::IDPInterface::IResult Result = Encoder.Acquire(Frame->Data, &Frame->FrameTag);
+	if (Result == pxr::IDPInterface::IResult::kOK)
+	{
+		NoteFrame(*Frame, CapacityBefore);
+		OutFrame = Frame;
+	}
+	return Result;
+}
+
+FPXRDPEncodedFramePtr FPXRDPEncodedFramePool::AcquirePacketPayload(const pxr::p_uint8* Payload, pxr::p_size PayloadLength, pxr::tunnel::DataTunnelPacket& Packet)
+{
+	FPXRDPEncodedFramePtr Frame = Acquire();
+	const pxr::p_size CapacityBefore = Frame->Data.capacity();
+	Frame->Data.assign(Payload, Payload + PayloadLength);
+	NoteFrame(*Frame, CapacityBefore);
+	Frame->FillPacket(Packet);
+	return Frame;
+}
+
+void FPXRDPEncodedFramePool::NoteFrame(const FPXRDPEncodedFrame& Frame, pxr::p_size CapacityBefore)
+{
+	// Keyframes can outgrow a slab; it keeps the larger capacity from then on
+	if (Frame.Data.capacity() > CapacityBefore)
+	{
+		Stats.NumGrows++;
+		SET_DWORD_STAT(STAT_PICOXRDPEncodedFrameGrows, Stats.NumGrows);
+	}
+	if (Frame.Data.size() > Stats.PeakFrameBytes)
+	{
+		Stats.PeakFrameBytes = Frame.Data.size();
+		SET_DWORD_STAT(STAT_PICOXRDPEncodedFramePeakKB, (uint32)(Stats.PeakFrameBytes / 1024));
+	}
+}
+
+void FPXRDPEncodedFramePool::Reset()
+{
+	PXR_LOGD(PxrUnreal, "PXR_DP Encoded frame pool reset: %d slabs, peak %d in use, peak frame %llu bytes, %u grows, %llu acquires",
+		Stats.NumSlabs, Stats.PeakInUse, Stats.PeakFrameBytes, Stats.NumGrows, Stats.NumAcquires);
+	Frames.Reset();
+	Stats = FPXRDPEncodedFramePoolStats();
+}
+#endif
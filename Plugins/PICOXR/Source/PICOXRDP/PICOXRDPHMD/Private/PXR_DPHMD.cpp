@@ -33,8 +33,6 @@
 #define ARRAYSIZE( a ) ( sizeof( ( a ) ) / sizeof( ( a )[ 0 ] ) )
 #endif
 
-static constexpr float DirectPreviewFov = 101.f;
-
 DEFINE_LOG_CATEGORY(LogPICODP);
 /** Helper function for acquiring the appropriate FSceneViewport */
 FSceneViewport* FindSceneViewport()
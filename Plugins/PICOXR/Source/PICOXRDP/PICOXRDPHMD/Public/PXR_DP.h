@@ -2,13 +2,17 @@
 
 #pragma once
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #if PLATFORM_WINDOWS
 #include "D3D11RHIPrivate.h"
 #include "streamer_api.h"
 #include "iinterface.h"
 #include "connector/terminal_interface.h"
+#include "PXR_DPFrameMessage.h"
 #endif
 
+static constexpr float DirectPreviewFov = 101.f;
+
 using namespace pxr::connector;
 using namespace pxr;
 
@@ -30,6 +34,8 @@ public:
 	void CreateSharedTexture2D();
 	bool CreateRHITexture(ID3D11Texture2D* OpenedSharedResource, EPixelFormat Format, FTexture2DRHIRef& OutTexture);
 	void GetPositionAndRotation(FVector &OutPostion,FQuat &OutQuat);
+	//Query both controllers from the remote HMD, 1 time per frame from the input device Tick; the controller getters below read this snapshot
+	void UpdateControllerSnapshot();
 	void GetControllerPositionAndRotation(int hand,float WorldScale, FVector& OutPostion, FRotator& OutQuat);
 	bool GetControllerConnectstatus(int hand);
 	
@@ -54,6 +60,30 @@ public:
 private:
 	uint32 count = 0;
 
+	struct FControllerSnapshot
+	{
+		bool bActive = false;
+		uint16 ButtonStatus = 0;
+		pxr::p_vector3_f Position = { 0.f, 0.f, 0.f };
+		pxr::p_vector4_f Rotation = { 0.f, 0.f, 0.f, 1.f };
+		float JoyStickX = 0.f;
+		float JoyStickY = 0.f;
+		float TriggerValue = 0.f;
+		float GripValue = 0.f;
+	};
+
+	FControllerSnapshot GetControllerSnapshot(int hand) const;
+
+	// Written on the game thread, also read by the render thread for late update
+	FControllerSnapshot ControllerSnapshots[2];
+	mutable FCriticalSection ControllerSnapshotLock;
+
+	// Reused by SendMessage every frame so steady-state submission does not rebuild the message
+	TerminalMessage SubmitMessage;
+	FPXRDPLegacyFrameEncoder LegacyFrameEncoder;
+	std::vector<TerminalMessage::Parameter> BinaryFrameParameters;
+	uint32 SubmittedFrameCount = 0;
+
 
 };
 typedef TSharedPtr<DP, ESPMode::ThreadSafe> FDP;
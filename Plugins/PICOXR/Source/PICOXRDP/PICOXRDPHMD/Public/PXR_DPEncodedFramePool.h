@@ -0,0 +1,67 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#if PLATFORM_WINDOWS
+#include <vector>
+#include "codec/encoder_interface.h"
+#include "tunnel/data_tunnel_packet.h"
+
+/** Bytes of one encoded frame (or tunnel payload), recycled through FPXRDPEncodedFramePool */
+class FPXRDPEncodedFrame
+{
+public:
+	/** Keeps its capacity across reuse, so the encoder writes into memory that is already there */
+	std::vector<pxr::p_uint8> Data;
+	void* FrameTag = nullptr;
+
+	/** Points the packet payload at Data without copying; only valid while this frame is held */
+	void FillPacket(pxr::tunnel::DataTunnelPacket& Packet)
+	{
+		Packet.SetPayload(Data.data());
+		Packet.SetPayloadLength(Data.size());
+	}
+};
+
+typedef TSharedPtr<FPXRDPEncodedFrame, ESPMode::ThreadSafe> FPXRDPEncodedFramePtr;
+
+struct FPXRDPEncodedFramePoolStats
+{
+	int32 NumSlabs = 0;
+	int32 NumInUse = 0;
+	int32 PeakInUse = 0;
+	/** Largest frame seen so far, and how often a slab had to grow past its capacity to hold one */
+	uint64 PeakFrameBytes = 0;
+	uint32 NumGrows = 0;
+	uint64 NumAcquires = 0;
+};
+
+/**
+ * Recycles encoded frame buffers owned by a single producer thread (the one pulling from the encoder).
+ * Frames can be released from any thread by dropping the pointer; a slab is reusable as soon as the pool holds its only reference.
+ */
+class PICOXRDPHMD_API FPXRDPEncodedFramePool
+{
+public:
+	explicit FPXRDPEncodedFramePool(int32 InSlabCapacity = 512 * 1024);
+
+	/** An empty frame with at least MinCapacity bytes reserved */
+	FPXRDPEncodedFramePtr Acquire(pxr::p_size MinCapacity = 0);
+
+	/** Pulls the latest encoder output into a pooled frame. OutFrame is only set when the encoder returns kOK */
+	pxr::IDPInterface::IResult AcquireFromEncoder(pxr::codec::EncoderInterface& Encoder, FPXRDPEncodedFramePtr& OutFrame);
+
+	/** A pooled copy of Payload, already hooked up to Packet */
+	FPXRDPEncodedFramePtr AcquirePacketPayload(const pxr::p_uint8* Payload, pxr::p_size PayloadLength, pxr::tunnel::DataTunnelPacket& Packet);
+
+	const FPXRDPEncodedFramePoolStats& GetStats() const { return Stats; }
+	void Reset();
+
+private:
+	void NoteFrame(const FPXRDPEncodedFrame& Frame, pxr::p_size CapacityBefore);
+
+	int32 SlabCapacity;
+	TArray<FPXRDPEncodedFramePtr> Frames;
+	FPXRDPEncodedFramePoolStats Stats;
+};
+#endif
@@ -56,8 +56,10 @@ FPICOXRDPInput::~FPICOXRDPInput()
 
 void FPICOXRDPInput::Tick(float DeltaTime)
 {
-	if (PICOXRHMD)
+	if (PICOXRHMD && PICOXRHMD->CurrentDirectPreview)
 	{
+		// Everything read from the remote controllers until the next Tick comes from this one snapshot
+		PICOXRHMD->CurrentDirectPreview->UpdateControllerSnapshot();
 		LeftConnectState = PICOXRHMD->CurrentDirectPreview->GetControllerConnectstatus(0);
 		RightConnectState = PICOXRHMD->CurrentDirectPreview->GetControllerConnectstatus(1);
 	}
@@ -78,6 +78,8 @@ public class PICOXRHMD : ModuleRules
 		        }
 	        );
         }
+        // No PICO runtime off device, Linux builds run the frame pipeline against an in-process mock (-pxrmock)
+        PublicDefinitions.Add("PICOXR_MOCK_RUNTIME=" + (Target.Platform == UnrealTargetPlatform.Linux ? "1" : "0"));
         if (Target.Platform == UnrealTargetPlatform.Android)
         {
 	        // Vulkan
@@ -0,0 +1,250 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "PXR_BoundaryCache.h"
+
+// Guardian polygons are a few hundred points at most, a finer grid only costs memory
+static const int32 MaxCellsPerAxis = 64;
+
+FPXRBoundaryCache::FPXRBoundaryCache()
+	: WindingSign(1.f)
+	, GridMin(FVector2D::ZeroVector)
+	, GridMax(FVector2D::ZeroVector)
+	, InvCellSize(1.f)
+	, CellSize(1.f)
+	, NumCellsX(0)
+	, NumCellsY(0)
+{
+}
+
+void FPXRBoundaryCache::Reset()
+{
+	Points.Reset();
+	Vertices.Reset();
+	CellStart.Reset();
+	CellSegments.Reset();
+	NumCellsX = 0;
+	NumCellsY = 0;
+}
+
+void FPXRBoundaryCache::Build(TArray<FVector>&& InPoints)
+{
+	Reset();
+	Points = MoveTemp(InPoints);
+
+	Vertices.Reserve(Points.Num());
+	for (const FVector& Point : Points)
+	{
+		Vertices.Add(FVector2D(Point.X, Point.Y));
+	}
+	// Some runtime versions close the loop by repeating the first point
+	if (Vertices.Num() > 3 && Vertices.Last().Equals(Vertices[0]))
+	{
+		Vertices.Pop(false);
+	}
+	if (Vertices.Num() < 3)
+	{
+		Vertices.Reset();
+		return;
+	}
+
+	const int32 NumSegments = Vertices.Num();
+	float DoubleArea = 0.f;
+	GridMin = Vertices[0];
+	GridMax = Vertices[0];
+	for (int32 Index = 0; Index < NumSegments; Index++)
+	{
+		const FVector2D& A = Vertices[Index];
+		const FVector2D& B = Vertices[(Index + 1) % NumSegments];
+		DoubleArea += (float)(A.X * B.Y - B.X * A.Y);
+		GridMin = FVector2D(FMath::Min(GridMin.X, A.X), FMath::Min(GridMin.Y, A.Y));
+		GridMax = FVector2D(FMath::Max(GridMax.X, A.X), FMath::Max(GridMax.Y, A.Y));
+	}
+	WindingSign = DoubleArea >= 0.f ? 1.f : -1.f;
+
+	// Aim for about one edge per cell
+	const FVector2D Extent = GridMax - GridMin;
+	const float MaxExtent = (float)FMath::Max(Extent.X, Extent.Y);
+	CellSize = FMath::Sqrt(FMath::Max((float)(Extent.X * Extent.Y), KINDA_SMALL_NUMBER) / NumSegments);
+	CellSize = FMath::Max3(CellSize, MaxExtent / MaxCellsPerAxis, KINDA_SMALL_NUMBER);
+	InvCellSize = 1.f / CellSize;
+	NumCellsX = FMath::Clamp(FMath::CeilToInt((float)Extent.X * InvCellSize), 1, MaxCellsPerAxis);
+	NumCellsY = FMath::Clamp(FMath::CeilToInt((float)Extent.Y * InvCellSize), 1, MaxCellsPerAxis);
+
+	// Every edge goes into each cell its bounding box overlaps, counted first so the cells share one array
+	CellStart.SetNumZeroed(NumCellsX * NumCellsY + 1);
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		TArray<int32> Cursor;
+		if (Pass == 1)
+		{
+			for (int32 Cell = 0; Cell < NumCellsX * NumCellsY; Cell++)
+			{
+				CellStart[Cell + 1] += CellStart[Cell];
+			}
+			CellSegments.SetNumUninitialized(CellStart.Last());
+			Cursor = CellStart;
+		}
+		for (int32 Segment = 0; Segment < NumSegments; Segment++)
+		{
+			const FVector2D& A = Vertices[Segment];
+			const FVector2D& B = Vertices[(Segment + 1) % NumSegments];
+			const int32 MinX = GetCellX((float)FMath::Min(A.X, B.X));
+			const int32 MaxX = GetCellX((float)FMath::Max(A.X, B.X));
+			const int32 MinY = GetCellY((float)FMath::Min(A.Y, B.Y));
+			const int32 MaxY = GetCellY((float)FMath::Max(A.Y, B.Y));
+			for (int32 Y = MinY; Y <= MaxY; Y++)
+			{
+				for (int32 X = MinX; X <= MaxX; X++)
+				{
+					const int32 Cell = Y * NumCellsX + X;
+					if (Pass == 0)
+					{
+						CellStart[Cell + 1]++;
+					}
+					else
+					{
+						CellSegments[Cursor[Cell]++] = Segment;
+					}
+				}
+			}
+		}
+	}
+}
+
+int32 FPXRBoundaryCache::GetCellX(float X) const
+{
+	return FMath::Clamp(FMath::FloorToInt((X - (float)GridMin.X) * InvCellSize), 0, NumCellsX - 1);
+}
+
+int32 FPXRBoundaryCache::GetCellY(float Y) const
+{
+	return FMath::Clamp(FMath::FloorToInt((Y - (float)GridMin.Y) * InvCellSize), 0, NumCellsY - 1);
+}
+
+void FPXRBoundaryCache::TestSegment(int32 Segment, const FVector2D& Point, float& BestDistanceSquared, int32& BestSegment, FVector2D& BestPoint) const
+{
+	const FVector2D& A = Vertices[Segment];
+	const FVector2D& B = Vertices[(Segment + 1) % Vertices.Num()];
+	const FVector2D Closest = FMath::ClosestPointOnSegment2D(Point, A, B);
+	const float DistanceSquared = (float)FVector2D::DistSquared(Point, Closest);
+	if (DistanceSquared < BestDistanceSquared)
+	{
+		BestDistanceSquared = DistanceSquared;
+		BestSegment = Segment;
+		BestPoint = Closest;
+	}
+}
+
+bool FPXRBoundaryCache::IsInside(const FVector2D& Point) const
+{
+	if (Point.X < GridMin.X || Point.Y < GridMin.Y || Point.X > GridMax.X || Point.Y > GridMax.Y)
+	{
+		return false;
+	}
+	// Crossing test along +X. Only the cells of the point's row to its right can hold a crossing, and a crossing is
+	// counted in the cell it falls in, so an edge stored in several of those cells is counted once
+	bool bInside = false;
+	const int32 NumSegments = Vertices.Num();
+	const int32 Row = GetCellY((float)Point.Y) * NumCellsX;
+	for (int32 X = GetCellX((float)Point.X); X < NumCellsX; X++)
+	{
+		const int32 Cell = Row + X;
+		for (int32 Index = CellStart[Cell]; Index < CellStart[Cell + 1]; Index++)
+		{
+			const FVector2D& A = Vertices[CellSegments[Index]];
+			const FVector2D& B = Vertices[(CellSegments[Index] + 1) % NumSegments];
+			if ((A.Y > Point.Y) != (B.Y > Point.Y))
+			{
+				const float CrossingX = (float)FMath::Clamp(A.X + (Point.Y - A.Y) * (B.X - A.X) / (B.Y - A.Y), FMath::Min(A.X, B.X), FMath::Max(A.X, B.X));
+				if (CrossingX > Point.X && GetCellX(CrossingX) == X)
+				{
+					bInside = !bInside;
+				}
+			}
+		}
+	}
+	return bInside;
+}
+
+void FPXRBoundaryCache::FillResult(const FVector& Point, float DistanceSquared, int32 Segment, const FVector2D& Closest, bool bInside, FQueryResult& OutResult) const
+{
+	const FVector2D Edge = Vertices[(Segment + 1) % Vertices.Num()] - Vertices[Segment];
+	OutResult.bInside = bInside;
+	OutResult.Distance = FMath::Sqrt(DistanceSquared);
+	OutResult.ClosestPoint = FVector(Closest.X, Closest.Y, Point.Z);
+	OutResult.ClosestPointNormal = (FVector(-Edge.Y, Edge.X, 0.f) * WindingSign).GetSafeNormal();
+}
+
+bool FPXRBoundaryCache::Query(const FVector& Point, FQueryResult& OutResult) const
+{
+	if (!CanQuery())
+	{
+		return false;
+	}
+	const FVector2D Point2D(Point.X, Point.Y);
+	// Start from the cell nearest to the point. Cells R rings away are at least (R - 1) cells from the point, also when
+	// the point is outside the grid, so the search stops once the best edge is closer than that
+	const int32 StartX = GetCellX((float)Point2D.X);
+	const int32 StartY = GetCellY((float)Point2D.Y);
+	const int32 MaxRing = FMath::Max(NumCellsX, NumCellsY);
+
+	float BestDistanceSquared = MAX_flt;
+	int32 BestSegment = INDEX_NONE;
+	FVector2D BestPoint = FVector2D::ZeroVector;
+	for (int32 Ring = 0; Ring <= MaxRing; Ring++)
+	{
+		const int32 MinY = FMath::Max(StartY - Ring, 0);
+		const int32 MaxY = FMath::Min(StartY + Ring, NumCellsY - 1);
+		for (int32 Y = MinY; Y <= MaxY; Y++)
+		{
+			const bool bFullRow = Y == StartY - Ring || Y == StartY + Ring;
+			const int32 Step = bFullRow ? 1 : FMath::Max(2 * Ring, 1);
+			for (int32 X = StartX - Ring; X <= StartX + Ring; X += Step)
+			{
+				if (X < 0 || X >= NumCellsX)
+				{
+					continue;
+				}
+				const int32 Cell = Y * NumCellsX + X;
+				for (int32 Index = CellStart[Cell]; Index < CellStart[Cell + 1]; Index++)
+				{
+					TestSegment(CellSegments[Index], Point2D, BestDistanceSquared, BestSegment, BestPoint);
+				}
+			}
+		}
+		const float Reach = Ring * CellSize;
+		if (BestSegment != INDEX_NONE && BestDistanceSquared <= Reach * Reach)
+		{
+			break;
+		}
+	}
+	check(BestSegment != INDEX_NONE);
+	FillResult(Point, BestDistanceSquared, BestSegment, BestPoint, IsInside(Point2D), OutResult);
+	return true;
+}
+
+bool FPXRBoundaryCache::QueryBruteForce(const FVector& Point, FQueryResult& OutResult) const
+{
+	if (!CanQuery())
+	{
+		return false;
+	}
+	const FVector2D Point2D(Point.X, Point.Y);
+	const int32 NumSegments = Vertices.Num();
+	float BestDistanceSquared = MAX_flt;
+	int32 BestSegment = INDEX_NONE;
+	FVector2D BestPoint = FVector2D::ZeroVector;
+	bool bInside = false;
+	for (int32 Segment = 0; Segment < NumSegments; Segment++)
+	{
+		TestSegment(Segment, Point2D, BestDistanceSquared, BestSegment, BestPoint);
+		const FVector2D& A = Vertices[Segment];
+		const FVector2D& B = Vertices[(Segment + 1) % NumSegments];
+		if ((A.Y > Point2D.Y) != (B.Y > Point2D.Y) && Point2D.X < A.X + (Point2D.Y - A.Y) * (B.X - A.X) / (B.Y - A.Y))
+		{
+			bInside = !bInside;
+		}
+	}
+	FillResult(Point, BestDistanceSquared, BestSegment, BestPoint, bInside, OutResult);
+	return true;
+}
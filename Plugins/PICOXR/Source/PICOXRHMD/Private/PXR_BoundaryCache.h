@@ -0,0 +1,64 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Boundary polygon converted to Unreal tracking space once, with its edges bucketed into a uniform grid so closest point,
+ * inside/outside and distance queries are answered locally without allocating.
+ * The boundary is treated as a vertical wall standing on the floor polygon, so all queries run in the XY plane.
+ */
+class FPXRBoundaryCache
+{
+public:
+	struct FQueryResult
+	{
+		bool bInside = false;
+		/** Horizontal distance from the query point to the nearest edge */
+		float Distance = 0.f;
+		/** On the nearest edge, at the height of the query point */
+		FVector ClosestPoint = FVector::ZeroVector;
+		/** Horizontal normal of the nearest edge, facing into the boundary */
+		FVector ClosestPointNormal = FVector::ZeroVector;
+	};
+
+	FPXRBoundaryCache();
+
+	/** Takes the polygon in Unreal units, in the order the runtime returns it */
+	void Build(TArray<FVector>&& InPoints);
+
+	void Reset();
+
+	/** False until built with at least a triangle */
+	bool CanQuery() const { return Vertices.Num() >= 3; }
+
+	const TArray<FVector>& GetPoints() const { return Points; }
+
+	bool Query(const FVector& Point, FQueryResult& OutResult) const;
+
+	/** Reference query that tests every edge, used to validate the grid */
+	bool QueryBruteForce(const FVector& Point, FQueryResult& OutResult) const;
+
+private:
+	int32 GetCellX(float X) const;
+	int32 GetCellY(float Y) const;
+
+	void TestSegment(int32 Segment, const FVector2D& Point, float& BestDistanceSquared, int32& BestSegment, FVector2D& BestPoint) const;
+	bool IsInside(const FVector2D& Point) const;
+	void FillResult(const FVector& Point, float DistanceSquared, int32 Segment, const FVector2D& Closest, bool bInside, FQueryResult& OutResult) const;
+
+	TArray<FVector> Points;
+	TArray<FVector2D> Vertices;
+	/** 1 for counter-clockwise winding, -1 for clockwise, so the inward normal of edge D is Sign * (-D.Y, D.X) */
+	float WindingSign;
+
+	FVector2D GridMin;
+	FVector2D GridMax;
+	float InvCellSize;
+	float CellSize;
+	int32 NumCellsX;
+	int32 NumCellsY;
+	/** Segments of cell C are CellSegments[CellStart[C] .. CellStart[C + 1]) */
+	TArray<int32> CellStart;
+	TArray<int32> CellSegments;
+};
@@ -0,0 +1,95 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "PXR_Benchmark.h"
+#include "PXR_BoundaryCache.h"
+
+// Compares the grid queries of FPXRBoundaryCache with testing every edge, on a synthetic guardian. Needs no device.
+// Query points are spread over twice the boundary's extent, at hand and head heights, and both paths must agree on every one.
+
+namespace PXRBoundaryCacheBenchmark
+{
+	/** Irregular closed loop around the origin, about 4 m by 3 m like a drawn guardian, in Unreal units */
+	static TArray<FVector> MakeBoundary(int32 NumPoints, FRandomStream& Random)
+	{
+		TArray<FVector> Points;
+		Points.Reserve(NumPoints);
+		for (int32 Index = 0; Index < NumPoints; Index++)
+		{
+			const float Angle = 2.f * PI * Index / NumPoints;
+			const float Radius = 1.f + 0.15f * FMath::Sin(Angle * 5.f) + Random.FRandRange(-0.05f, 0.05f);
+			Points.Add(FVector(FMath::Cos(Angle) * Radius * 200.f, FMath::Sin(Angle) * Radius * 150.f, 0.f));
+		}
+		return Points;
+	}
+
+	/** Both paths test the same segments, so the distances only differ by rounding */
+	static const float MaxDistanceTolerance = 0.01f;
+
+	static void Execute(const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+	{
+		FPXRBenchmark Benchmark(TEXT("pxr.Boundary.BenchmarkQueries"), Args, Ar);
+		const int32 NumPoints = FMath::Max(Benchmark.Param(TEXT("Points="), 256), 3);
+		const int32 NumQueries = FMath::Max(Benchmark.Param(TEXT("Queries="), 100000), 1);
+
+		FRandomStream Random(0x50584252);
+		FPXRBoundaryCache Cache;
+		const uint64 BuildStartCycles = FPlatformTime::Cycles64();
+		Cache.Build(MakeBoundary(NumPoints, Random));
+		const uint64 BuildCycles = FPlatformTime::Cycles64() - BuildStartCycles;
+
+		TArray<FVector> Queries;
+		Queries.Reserve(NumQueries);
+		for (int32 Index = 0; Index < NumQueries; Index++)
+		{
+			Queries.Add(FVector(Random.FRandRange(-400.f, 400.f), Random.FRandRange(-300.f, 300.f), Random.FRandRange(80.f, 180.f)));
+		}
+
+		TArray<FPXRBoundaryCache::FQueryResult> GridResults;
+		TArray<FPXRBoundaryCache::FQueryResult> BruteForceResults;
+		GridResults.SetNum(NumQueries);
+		BruteForceResults.SetNum(NumQueries);
+
+		uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumQueries; Index++)
+		{
+			Cache.Query(Queries[Index], GridResults[Index]);
+		}
+		const uint64 GridCycles = FPlatformTime::Cycles64() - StartCycles;
+
+		StartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumQueries; Index++)
+		{
+			Cache.QueryBruteForce(Queries[Index], BruteForceResults[Index]);
+		}
+		const uint64 BruteForceCycles = FPlatformTime::Cycles64() - StartCycles;
+
+		int32 InsideMismatches = 0;
+		float MaxDistanceError = 0.f;
+		for (int32 Index = 0; Index < NumQueries; Index++)
+		{
+			InsideMismatches += GridResults[Index].bInside != BruteForceResults[Index].bInside ? 1 : 0;
+			MaxDistanceError = FMath::Max(MaxDistanceError, FMath::Abs(GridResults[Index].Distance - BruteForceResults[Index].Distance));
+		}
+
+		Ar.Logf(TEXT("PICOXR boundary query benchmark: %d points, %d queries, grid built in %.3f ms"), NumPoints, NumQueries, FPlatformTime::ToMilliseconds64(BuildCycles));
+		Benchmark.BeginTable(FPXRBenchmark::EUnit::Nanoseconds);
+		Benchmark.Row(TEXT("grid"), GridCycles, NumQueries);
+		Benchmark.Row(TEXT("every edge"), BruteForceCycles, NumQueries);
+		Benchmark.Check(InsideMismatches == 0, TEXT("%d of %d queries disagree on inside"), InsideMismatches, NumQueries);
+		Benchmark.Check(MaxDistanceError <= MaxDistanceTolerance, TEXT("distance differs by up to %g"), MaxDistanceError);
+		Benchmark.Finish();
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchmarkCommand(
+		TEXT("pxr.Boundary.BenchmarkQueries"),
+		TEXT("Runs closest point and inside queries against a synthetic boundary through the edge grid and by testing every edge, reports CPU time and fails on any mismatch.\n")
+		TEXT("Params: Points= Queries="),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Execute));
+}
+
+#endif
@@ -5,6 +5,14 @@
 #include "PXR_Utils.h"
 #include "XRThreadUtils.h"
 #include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "IMotionController.h"
+#include "Features/IModularFeatures.h"
+#include "PXR_Log.h"
+#include "PXR_EventManager.h"
+#include "Async/Async.h"
+#include "RenderingThread.h"
 
 #if PLATFORM_ANDROID
 #include "Android/AndroidApplication.h"
@@ -15,6 +23,27 @@
 #include "PxrTypes.h"
 #endif
 
+static TAutoConsoleVariable<int32> CVarPICOBoundaryLocalQueries(
+	TEXT("vr.PICO.Boundary.LocalQueries"),
+	0,
+	TEXT("1 answers boundary node and point tests from the cached boundary polygon, 0 asks the runtime on every test.\n")
+	TEXT("Local tests decide IsTriggering from vr.PICO.Boundary.TriggerDistance, not from the runtime's own rule, so they are off by default."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPICOBoundaryGeometryRefreshInterval(
+	TEXT("vr.PICO.Boundary.GeometryRefreshInterval"),
+	5.0f,
+	TEXT("Seconds after which the cached boundary polygon is read again even though no event invalidated it. 0 only rereads it on events."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPICOBoundaryTriggerDistance(
+	TEXT("vr.PICO.Boundary.TriggerDistance"),
+	0.3f,
+	TEXT("Distance in meters to the boundary under which a locally tested node or point reports IsTriggering."),
+	ECVF_Default);
+
+FThreadSafeCounter UPICOXRBoundarySystem::GeometryVersion;
+
 UPICOXRBoundarySystem* UPICOXRBoundarySystem::BoundaryInstance = nullptr;
 UPICOXRBoundarySystem* UPICOXRBoundarySystem::GetInstance()
 {
@@ -22,22 +51,34 @@ UPICOXRBoundarySystem* UPICOXRBoundarySystem::GetInstance()
 	{
 		BoundaryInstance = NewObject<UPICOXRBoundarySystem>();
 		BoundaryInstance->AddToRoot();
+		BoundaryInstance->ResolveMotionController();
+		IModularFeatures& ModularFeatures = IModularFeatures::Get();
+		BoundaryInstance->ModularFeatureRegisteredHandle = ModularFeatures.OnModularFeatureRegistered().AddUObject(BoundaryInstance, &UPICOXRBoundarySystem::OnModularFeatureRegistered);
+		BoundaryInstance->ModularFeatureUnregisteredHandle = ModularFeatures.OnModularFeatureUnregistered().AddUObject(BoundaryInstance, &UPICOXRBoundarySystem::OnModularFeatureUnregistered);
 	}
 	return BoundaryInstance;
 }
 
 UPICOXRBoundarySystem::UPICOXRBoundarySystem()
-	:bIsStartCamera(false)
+	:MotionController(nullptr)
+	,bIsStartCamera(false)
 	,CurrentImageSize(FIntPoint(640,640))
-	,CameraTextureLeft(nullptr)
-	,CameraTextureRight(nullptr)
-	,LeftTextureID(-1)
-	,RightTextureID(-1)
 {
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(CameraTextures); Index++)
+	{
+		CameraTextures[Index] = nullptr;
+	}
+	FrontCameraBuffer[0].Set(-1);
+	FrontCameraBuffer[1].Set(-1);
 }
 
 UPICOXRBoundarySystem::~UPICOXRBoundarySystem()
 {
+	if (ModularFeatureRegisteredHandle.IsValid())
+	{
+		IModularFeatures::Get().OnModularFeatureRegistered().Remove(ModularFeatureRegisteredHandle);
+		IModularFeatures::Get().OnModularFeatureUnregistered().Remove(ModularFeatureUnregisteredHandle);
+	}
 #if PLATFORM_ANDROID
 	if (bIsStartCamera)
 	{
@@ -83,9 +124,138 @@ bool UPICOXRBoundarySystem::UPxr_GetVisible()
 	return  false;
 }
 
+void UPICOXRBoundarySystem::InvalidateGeometryCache()
+{
+	GeometryVersion.Increment();
+}
+
+const FPXRBoundaryCache& UPICOXRBoundarySystem::GetGeometryCache(bool bIsPlayArea)
+{
+	FGeometryCacheEntry& Entry = GeometryCache[bIsPlayArea ? 1 : 0];
+	if (!GEngine || !GEngine->XRSystem.IsValid())
+	{
+		return Entry.Cache;
+	}
+	const int32 CurrentVersion = GeometryVersion.GetValue();
+	const float WorldToMetersScale = GEngine->XRSystem->GetWorldToMetersScale();
+	const float RefreshInterval = CVarPICOBoundaryGeometryRefreshInterval.GetValueOnGameThread();
+	const double Now = FPlatformTime::Seconds();
+	if (Entry.Version == CurrentVersion && Entry.WorldToMetersScale == WorldToMetersScale
+		&& (RefreshInterval <= 0.f || Now - Entry.BuildTimeSeconds < RefreshInterval))
+	{
+		return Entry.Cache;
+	}
+
+	TArray<FVector> BoundaryGeometry;
+#if PLATFORM_ANDROID
+	uint32_t pointsCountOutput = 0;
+	if (Pxr_GetBoundaryGeometry(bIsPlayArea, 0, &pointsCountOutput, nullptr) == 0 && pointsCountOutput > 0)
+	{
+		TArray<PxrVector3f> Data;
+		Data.SetNumUninitialized(pointsCountOutput);
+		if (Pxr_GetBoundaryGeometry(bIsPlayArea, pointsCountOutput, &pointsCountOutput, Data.GetData()) == 0)
+		{
+			BoundaryGeometry.Reserve(pointsCountOutput);
+			for (uint32_t i = 0; i < pointsCountOutput && i < (uint32_t)Data.Num(); i++)
+			{
+				FVector TempVector = FVector(Data[i].x, Data[i].y, Data[i].z);
+				BoundaryGeometry.Add(FPICOXRUtils::ConvertXRVectorToUnrealVector(TempVector, WorldToMetersScale));
+			}
+		}
+	}
+#endif
+	PXR_LOGD(PxrUnreal, "Boundary geometry cached, PlayArea:%d Points:%d", bIsPlayArea, BoundaryGeometry.Num());
+	Entry.Cache.Build(MoveTemp(BoundaryGeometry));
+	Entry.Version = CurrentVersion;
+	Entry.BuildTimeSeconds = Now;
+	Entry.WorldToMetersScale = WorldToMetersScale;
+	return Entry.Cache;
+}
+
+bool UPICOXRBoundarySystem::TestPointLocally(const FVector& Point, bool bIsPlayArea, bool& IsTriggering, float& ClosestDistance,
+	FVector& ClosestPoint, FVector& ClosestPointNormal)
+{
+	if (!CVarPICOBoundaryLocalQueries.GetValueOnGameThread())
+	{
+		return false;
+	}
+	FPXRBoundaryCache::FQueryResult Result;
+	if (!GetGeometryCache(bIsPlayArea).Query(Point, Result))
+	{
+		return false;
+	}
+	const float WorldToMetersScale = GeometryCache[bIsPlayArea ? 1 : 0].WorldToMetersScale;
+	// Same units the runtime reports: the distance in meters, the points in Unreal units
+	ClosestDistance = Result.Distance / WorldToMetersScale;
+	IsTriggering = !Result.bInside || ClosestDistance < CVarPICOBoundaryTriggerDistance.GetValueOnGameThread();
+	ClosestPoint = Result.ClosestPoint;
+	ClosestPointNormal = Result.ClosestPointNormal;
+	return true;
+}
+
+bool UPICOXRBoundarySystem::GetNodeLocation(int DeviceType, FVector& OutLocation) const
+{
+	if (!GEngine || !GEngine->XRSystem.IsValid())
+	{
+		return false;
+	}
+	if (DeviceType == 2)
+	{
+		FQuat Orientation;
+		return GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, Orientation, OutLocation);
+	}
+
+	if (!MotionController)
+	{
+		return false;
+	}
+	FRotator Orientation;
+	const EControllerHand Hand = DeviceType == 0 ? EControllerHand::Left : EControllerHand::Right;
+	return MotionController->GetControllerOrientationAndPosition(0, Hand, Orientation, OutLocation, GEngine->XRSystem->GetWorldToMetersScale());
+}
+
+void UPICOXRBoundarySystem::ResolveMotionController(IModularFeature* UnregisteringFeature)
+{
+	static const FName MotionControllerName(TEXT("PICOXRInput"));
+	MotionController = nullptr;
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+	const int32 NumMotionControllers = ModularFeatures.GetModularFeatureImplementationCount(IMotionController::GetModularFeatureName());
+	for (int32 Index = 0; Index < NumMotionControllers; Index++)
+	{
+		IModularFeature* ModularFeature = ModularFeatures.GetModularFeatureImplementation(IMotionController::GetModularFeatureName(), Index);
+		IMotionController* Candidate = static_cast<IMotionController*>(ModularFeature);
+		if (ModularFeature != UnregisteringFeature && Candidate && Candidate->GetMotionControllerDeviceTypeName() == MotionControllerName)
+		{
+			MotionController = Candidate;
+			return;
+		}
+	}
+}
+
+void UPICOXRBoundarySystem::OnModularFeatureRegistered(const FName& Type, IModularFeature* ModularFeature)
+{
+	if (Type == IMotionController::GetModularFeatureName())
+	{
+		ResolveMotionController();
+	}
+}
+
+void UPICOXRBoundarySystem::OnModularFeatureUnregistered(const FName& Type, IModularFeature* ModularFeature)
+{
+	if (Type == IMotionController::GetModularFeatureName())
+	{
+		ResolveMotionController(ModularFeature);
+	}
+}
+
 bool UPICOXRBoundarySystem::UPxr_TestNode(int DeviceType, bool bIsPlayArea, bool& IsTriggering, float& ClosestDistance,
 	FVector& ClosestPoint, FVector& ClosestPointNormal)
 {
+	FVector NodeLocation;
+	if (GetNodeLocation(DeviceType, NodeLocation) && TestPointLocally(NodeLocation, bIsPlayArea, IsTriggering, ClosestDistance, ClosestPoint, ClosestPointNormal))
+	{
+		return true;
+	}
 #if PLATFORM_ANDROID
 	bool ret = true;
 	PxrBoundaryTestNode node = static_cast<PxrBoundaryTestNode>(DeviceType);
@@ -110,6 +280,10 @@ bool UPICOXRBoundarySystem::UPxr_TestNode(int DeviceType, bool bIsPlayArea, bool
 bool UPICOXRBoundarySystem::UPxr_TestPoint(FVector Point, bool bIsPlayArea, bool& IsTriggering, float& ClosestDistance,
 	FVector& ClosestPoint, FVector& ClosestPointNormal)
 {
+	if (TestPointLocally(Point, bIsPlayArea, IsTriggering, ClosestDistance, ClosestPoint, ClosestPointNormal))
+	{
+		return true;
+	}
 #if PLATFORM_ANDROID
 	Point = FPICOXRUtils::ConvertUnrealVectorToXRVector(Point, GEngine->XRSystem->GetWorldToMetersScale());
 	PxrBoundaryTriggerInfo Info;
@@ -137,31 +311,7 @@ bool UPICOXRBoundarySystem::UPxr_TestPoint(FVector Point, bool bIsPlayArea, bool
 
 TArray<FVector> UPICOXRBoundarySystem::UPxr_GetGeometry(bool bIsPlayArea)
 {
-	TArray<FVector> BoundaryGeometry; 
-#if PLATFORM_ANDROID
-	uint32_t pointsCountOutput = -1;
-	PxrVector3f * outPointsFirst = nullptr;
-	if (Pxr_GetBoundaryGeometry(bIsPlayArea,0,&pointsCountOutput,outPointsFirst) == 0)
-	{
-		if (pointsCountOutput <= 0)
-		{
-			return BoundaryGeometry;
-		}
-
-		PxrVector3f * Data = new PxrVector3f[pointsCountOutput];
-		if (Pxr_GetBoundaryGeometry(bIsPlayArea, pointsCountOutput, &pointsCountOutput, Data) == 0)
-		{
-			for (uint32_t i = 0; i < pointsCountOutput; i++)
-			{
-				FVector TempVector = FVector(Data[i].x,Data[i].y,Data[i].z);
-				TempVector = FPICOXRUtils::ConvertXRVectorToUnrealVector(TempVector, GEngine->XRSystem->GetWorldToMetersScale());
-				BoundaryGeometry.Add(TempVector);
-			}
-		}
-		delete[]Data;
-	}	
-#endif
-	return BoundaryGeometry;
+	return GetGeometryCache(bIsPlayArea).GetPoints();
 }
 
 FVector UPICOXRBoundarySystem::UPxr_GetDimensions(bool bIsPlayArea)
@@ -178,179 +328,97 @@ FVector UPICOXRBoundarySystem::UPxr_GetDimensions(bool bIsPlayArea)
 	return Dimensions;
 }
 
-bool UPICOXRBoundarySystem::UPxr_GetSeeThroughData(int CameraType, UTexture2D*& CameraImage)
+void UPICOXRBoundarySystem::UpdateCameraTextures(int32 Camera)
+{
+	const UTexture2D* FirstBuffer = CameraTextures[Camera * 2];
+	if (FirstBuffer && FirstBuffer->GetSizeX() == CurrentImageSize.X && FirstBuffer->GetSizeY() == CurrentImageSize.Y)
+	{
+		return;
+	}
+	// Replaced buffers are released by the garbage collector, after any write still queued for them
+	for (int32 Buffer = 0; Buffer < 2; Buffer++)
+	{
+		UTexture2D* Texture = UTexture2D::CreateTransient(CurrentImageSize.X, CurrentImageSize.Y, EPixelFormat::PF_R8G8B8A8);
+		check(Texture);
+		Texture->UpdateResource();
+		CameraTextures[Camera * 2 + Buffer] = Texture;
+	}
+	FrontCameraBuffer[Camera].Set(-1);
+	PXR_LOGD(PxrUnreal, "See through camera %d buffers created, Size:%d x %d", Camera, CurrentImageSize.X, CurrentImageSize.Y);
+}
+
+void UPICOXRBoundarySystem::RequestSeeThroughFrame(int32 Camera, int32 Buffer)
 {
 #if PLATFORM_ANDROID
-	if(bIsStartCamera == false)
+	if (bCameraRequestPending[Camera])
 	{
-		ExecuteOnRenderThread([]()
-        {         
-          ExecuteOnRHIThread([]()
-          {
-          Pxr_StartCameraPreview(1);
-          });
-        });
-		FPlatformProcess::Sleep(0.1);
-		bIsStartCamera = true;
+		return;
 	}
-	if (CameraType == 0)
+	bCameraRequestPending[Camera] = true;
+	UTexture2D* Texture = CameraTextures[Camera * 2 + Buffer];
+	FTextureResource* Resource = Texture->Resource;
+	const FIntPoint ImageSize(Texture->GetSizeX(), Texture->GetSizeY());
+	TWeakObjectPtr<UTexture2D> WeakTexture(Texture);
+	ENQUEUE_RENDER_COMMAND(PICOXRRequestSeeThroughFrame)([this, Resource, Camera, Buffer, ImageSize, WeakTexture](FRHICommandListImmediate& RHICmdList)
 	{
-		if (CameraTextureLeft == nullptr)
+		if (!Resource || !Resource->TextureRHI)
 		{
-			CameraTextureLeft = UTexture2D::CreateTransient(CurrentImageSize.X,CurrentImageSize.Y, EPixelFormat::PF_R8G8B8A8);
-			check(CameraTextureLeft);
-#if ENGINE_MINOR_VERSION > 25
-			FTextureResource* Resource = CameraTextureLeft->CreateResource();
-#else	
-			FTexture2DResource* Resource = static_cast<FTexture2DResource *>(CameraTextureLeft->CreateResource());
-#endif
-			CameraTextureLeft->UpdateResource();
-			ExecuteOnRenderThread([Resource,this]()
-	        {
-	            Resource->InitRHI();
-	            ExecuteOnRHIThread([Resource,this]()
-	            {
-#if ENGINE_MINOR_VERSION > 25
-						LeftTextureID = (*static_cast<int32_t*>(Resource->GetTexture2DRHI()->GetNativeResource())) - 1;
-#else
-						LeftTextureID = *static_cast<int32_t*>(Resource->GetTexture2DRHI()->GetNativeResource());
-#endif
-	            });
-	        });
-			delete Resource;
-			Resource = nullptr;
+			bCameraRequestPending[Camera] = false;
+			return;
 		}
-		else
+		// With an RHI thread the GL texture is created there, so its name is only readable once the RHI thread reaches this
+		FTextureRHIRef TextureRHI = Resource->TextureRHI;
+		ExecuteOnRHIThread_DoNotWait([this, Camera, Buffer, ImageSize, TextureRHI, WeakTexture]()
 		{
-			if ((CameraTextureLeft->GetSizeY() != CurrentImageSize.Y)|| (CameraTextureLeft->GetSizeX() != CurrentImageSize.X))
+			const int32_t TextureID = *static_cast<int32_t*>(TextureRHI->GetNativeResource());
+			PxrSeeThoughData seeThoughData;
+			seeThoughData.leftEyeTextureId = Camera == 0 ? TextureID : 0;
+			seeThoughData.rightEyeTextureId = Camera == 0 ? 0 : TextureID;
+			seeThoughData.width = ImageSize.X;
+			seeThoughData.height = ImageSize.Y;
+			seeThoughData.exposure = 0;
+			seeThoughData.startTimeOfExposure = 0;
+			seeThoughData.valid = true;
+			const int Result = Pxr_GetSeeThroughData(&seeThoughData);
+			if (Result == 0)
 			{
-				CameraTextureLeft->ReleaseResource();
-				CameraTextureLeft = UTexture2D::CreateTransient(CurrentImageSize.X,CurrentImageSize.Y, EPixelFormat::PF_R8G8B8A8);
-				check(CameraTextureLeft);
-#if ENGINE_MINOR_VERSION > 25
-				FTextureResource* Resource = CameraTextureLeft->CreateResource();
-#else	
-				FTexture2DResource* Resource = static_cast<FTexture2DResource *>(CameraTextureLeft->CreateResource());
-#endif
-				CameraTextureLeft->UpdateResource();
-				ExecuteOnRenderThread([Resource,this]()
-                {
-                    Resource->InitRHI();
-                    ExecuteOnRHIThread([Resource,this]()
-                    {
-#if ENGINE_MINOR_VERSION > 25
-							LeftTextureID = (*static_cast<int32_t*>(Resource->GetTexture2DRHI()->GetNativeResource())) - 1;
-#else
-							LeftTextureID = *static_cast<int32_t*>(Resource->GetTexture2DRHI()->GetNativeResource());
-#endif
-                    });
-                });
-				delete Resource;
-				Resource = nullptr;
+				FrontCameraBuffer[Camera].Set(Buffer);
+				AsyncTask(ENamedThreads::GameThread, [Camera, WeakTexture]()
+				{
+					if (WeakTexture.IsValid())
+					{
+						UPICOXREventManager::GetInstance()->SeeThroughFrameReadyDelegate.Broadcast(Camera, WeakTexture.Get());
+					}
+				});
 			}
-		}
-		ExecuteOnRenderThread([this]()
-        {
-            ExecuteOnRHIThread([this]()
-            {
-	           uint32_t exposure = 0;
-	           int64_t start_of_exposure_ts = 0;
-			   bool ret = true;
-	           uint32_t SizeX =	CameraTextureLeft->GetSizeX();
-	           uint32_t SizeY =	CameraTextureLeft->GetSizeY();
-			   PxrSeeThoughData seeThoughData;
-			   seeThoughData.leftEyeTextureId = LeftTextureID;
-			   seeThoughData.rightEyeTextureId = 0;
-			   seeThoughData.width = SizeX;
-			   seeThoughData.height = SizeY;
-			   seeThoughData.exposure = exposure;
-			   seeThoughData.startTimeOfExposure = start_of_exposure_ts;
-			   seeThoughData.valid = ret;
-			   int result = Pxr_GetSeeThroughData(&seeThoughData);
-            });
-        });
-		CameraImage = CameraTextureLeft;
-		return true;
-	}else
-	{
-		if (CameraTextureRight == nullptr)
-		{
-			CameraTextureRight = UTexture2D::CreateTransient(CurrentImageSize.X,CurrentImageSize.Y, EPixelFormat::PF_R8G8B8A8);
-			check(CameraTextureRight);
-#if ENGINE_MINOR_VERSION > 25
-			FTextureResource* Resource = CameraTextureRight->CreateResource();
-#else	
-			FTexture2DResource* Resource = static_cast<FTexture2DResource *>(CameraTextureRight->CreateResource());
-#endif
-			CameraTextureRight->UpdateResource();
-			ExecuteOnRenderThread([Resource,this]()
-	        {
-	            Resource->InitRHI();
-	            ExecuteOnRHIThread([Resource,this]()
-	            {
-#if ENGINE_MINOR_VERSION > 25
-						RightTextureID = (*static_cast<int32_t*>(Resource->GetTexture2DRHI()->GetNativeResource())) - 1;
-#else
-						RightTextureID = *static_cast<int32_t*>(Resource->GetTexture2DRHI()->GetNativeResource());
+			bCameraRequestPending[Camera] = false;
+		});
+	});
 #endif
-	            });
-	        });
-			delete Resource;
-			Resource = nullptr;
-		}
-		else
+}
+
+bool UPICOXRBoundarySystem::UPxr_GetSeeThroughData(int CameraType, UTexture2D*& CameraImage)
+{
+#if PLATFORM_ANDROID
+	if (!bIsStartCamera)
+	{
+		// The first frames come back empty until the camera is running, nothing waits for it
+		ENQUEUE_RENDER_COMMAND(PICOXRStartCameraPreview)([](FRHICommandListImmediate& RHICmdList)
 		{
-			if ((CameraTextureRight->GetSizeY() != CurrentImageSize.Y)|| (CameraTextureRight->GetSizeX() != CurrentImageSize.X))
+			ExecuteOnRHIThread_DoNotWait([]()
 			{
-				CameraTextureRight->ReleaseResource();
-				CameraTextureRight = UTexture2D::CreateTransient(CurrentImageSize.X,CurrentImageSize.Y, EPixelFormat::PF_R8G8B8A8);
-				check(CameraTextureRight);
-#if ENGINE_MINOR_VERSION > 25
-				FTextureResource* Resource = CameraTextureRight->CreateResource();
-#else	
-				FTexture2DResource* Resource = static_cast<FTexture2DResource *>(CameraTextureRight->CreateResource());
-#endif
-				CameraTextureRight->UpdateResource();
-				ExecuteOnRenderThread([Resource,this]()
-                {
-                    Resource->InitRHI();
-                    ExecuteOnRHIThread([Resource,this]()
-                    {
-#if ENGINE_MINOR_VERSION > 25
-							RightTextureID = (*static_cast<int32_t*>(Resource->GetTexture2DRHI()->GetNativeResource())) - 1;
-#else
-							RightTextureID = *static_cast<int32_t*>(Resource->GetTexture2DRHI()->GetNativeResource());
-#endif
-                    });
-                });
-				delete Resource;
-				Resource = nullptr;
-			}
-		}
-		ExecuteOnRenderThread([this]()
-        {
-            ExecuteOnRHIThread([this]()
-            {
-			   uint32_t exposure = 0;
-			   int64_t start_of_exposure_ts = 0;
-			   bool ret = true;
-			   uint32_t SizeX = CameraTextureLeft->GetSizeX();
-			   uint32_t SizeY = CameraTextureLeft->GetSizeY();
-			   PxrSeeThoughData seeThoughData;
-			   seeThoughData.leftEyeTextureId = 0;
-			   seeThoughData.rightEyeTextureId = RightTextureID;
-			   seeThoughData.width = SizeX;
-			   seeThoughData.height = SizeY;
-			   seeThoughData.exposure = exposure;
-			   seeThoughData.startTimeOfExposure = start_of_exposure_ts;
-			   seeThoughData.valid = ret;
-			   int result = Pxr_GetSeeThroughData(&seeThoughData);
-            });
-        });
-		CameraImage = CameraTextureRight;
-		return true;
+				Pxr_StartCameraPreview(1);
+			});
+		});
+		bIsStartCamera = true;
 	}
-
+	const int32 Camera = CameraType == 0 ? 0 : 1;
+	UpdateCameraTextures(Camera);
+	const int32 FrontBuffer = FrontCameraBuffer[Camera].GetValue();
+	const int32 BackBuffer = FrontBuffer == 0 ? 1 : 0;
+	RequestSeeThroughFrame(Camera, BackBuffer);
+	CameraImage = CameraTextures[Camera * 2 + (FrontBuffer < 0 ? BackBuffer : FrontBuffer)];
+	return true;
 #endif
 	return  false;
 }
@@ -4,8 +4,12 @@
 #include "CoreMinimal.h"
 #include "Engine/Texture2D.h"
 #include "UObject/Object.h"
+#include "PXR_BoundaryCache.h"
 #include "PXR_BoundarySystem.generated.h"
 
+class IModularFeature;
+class IMotionController;
+
 UCLASS()
 class UPICOXRBoundarySystem : public UObject
 {
@@ -35,17 +39,60 @@ public:
 
 	FVector UPxr_GetDimensions(bool BoundaryType);
 
+	/** Returns the newest camera image without waiting and requests the next one, which is written into the other buffer of the camera */
 	bool UPxr_GetSeeThroughData(int CameraType,UTexture2D* &CameraImage);
 
 	bool UPxr_SetCameraImageSize(FIntPoint ImageSize);
 
 	int UPxr_SetSeeThroughBackground(bool value);
 
+	/** Marks the cached boundary geometry stale, for when the boundary or the tracking space may have changed. Any thread */
+	static void InvalidateGeometryCache();
+
 private:
+	/** Reads the polygon from the runtime again when the cached one is stale */
+	const FPXRBoundaryCache& GetGeometryCache(bool bIsPlayArea);
+
+	bool TestPointLocally(const FVector& Point, bool bIsPlayArea, bool& IsTriggering, float& ClosestDistance, FVector& ClosestPoint, FVector& ClosestPointNormal);
+
+	/** Tracking space location of a PxrBoundaryTestNode: 0 left hand, 1 right hand, 2 head */
+	bool GetNodeLocation(int DeviceType, FVector& OutLocation) const;
+
+	/** Finds the PICOXRInput motion controller, skipping one that is being unregistered */
+	void ResolveMotionController(IModularFeature* UnregisteringFeature = nullptr);
+	void OnModularFeatureRegistered(const FName& Type, IModularFeature* ModularFeature);
+	void OnModularFeatureUnregistered(const FName& Type, IModularFeature* ModularFeature);
+
+	static FThreadSafeCounter GeometryVersion;
+
+	/** Creates both buffers of a camera, or recreates them when the requested image size changed */
+	void UpdateCameraTextures(int32 Camera);
+
+	/** Fills a buffer on the RHI thread, makes it the front buffer once the runtime wrote it and notifies the event manager */
+	void RequestSeeThroughFrame(int32 Camera, int32 Buffer);
+
+	struct FGeometryCacheEntry
+	{
+		FPXRBoundaryCache Cache;
+		int32 Version = -1;
+		double BuildTimeSeconds = 0.0;
+		float WorldToMetersScale = 0.f;
+	};
+	/** Indexed by bIsPlayArea */
+	FGeometryCacheEntry GeometryCache[2];
+
+	/** Controller the hand nodes are located with, kept current by the modular feature events */
+	IMotionController* MotionController;
+	FDelegateHandle ModularFeatureRegisteredHandle;
+	FDelegateHandle ModularFeatureUnregisteredHandle;
+
 	bool bIsStartCamera;
 	FIntPoint CurrentImageSize;
-	UTexture2D* CameraTextureLeft;
-	UTexture2D* CameraTextureRight;
-	int32_t LeftTextureID;
-	int32_t RightTextureID;
+	/** Two buffers per camera, left camera first */
+	UPROPERTY()
+	UTexture2D* CameraTextures[4];
+	/** Buffer last written by the runtime for each camera, -1 before the first frame */
+	FThreadSafeCounter FrontCameraBuffer[2];
+	/** Set while a frame is being written, so a slow camera does not pile up requests */
+	FThreadSafeBool bCameraRequestPending[2];
 };
@@ -0,0 +1,66 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+#if !UE_BUILD_SHIPPING
+/** Forwards everything to the real allocator and counts Malloc/Realloc calls while a benchmark runs */
+class FPXRCountingMalloc : public FMalloc
+{
+public:
+	explicit FPXRCountingMalloc(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc) {}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Allocations.Increment();
+		AllocatedBytes.Add((int64)Count);
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		Allocations.Increment();
+		AllocatedBytes.Add((int64)Count);
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+	virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+	virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+	virtual const TCHAR* GetDescriptiveName() override { return TEXT("PXRCountingMalloc"); }
+
+	/** Routes GMalloc through the shared counting allocator for the lifetime of the scope */
+	class FScope
+	{
+	public:
+		FScope()
+			: PreviousMalloc(GMalloc)
+		{
+			static FPXRCountingMalloc* CountingMalloc = nullptr;
+			if (!CountingMalloc)
+			{
+				CountingMalloc = new FPXRCountingMalloc(GMalloc);
+			}
+			Counter = CountingMalloc;
+			Counter->InnerMalloc = PreviousMalloc;
+			GMalloc = Counter;
+		}
+		~FScope()
+		{
+			GMalloc = PreviousMalloc;
+		}
+
+		FPXRCountingMalloc* Counter;
+
+	private:
+		FMalloc* PreviousMalloc;
+	};
+
+	FMalloc* InnerMalloc;
+	FThreadSafeCounter64 Allocations;
+	FThreadSafeCounter64 AllocatedBytes;
+};
+#endif
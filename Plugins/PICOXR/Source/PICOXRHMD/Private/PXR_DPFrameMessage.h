@@ -0,0 +1,181 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include <vector>
+#include "connector/terminal_message.hpp"
+
+/**
+ * Per-frame eye layer submission that direct preview pushes to the PICO runtime.
+ * Header only so both PICOXRDPHMD (Win64) and the codec benchmark in PICOXRHMD can use it.
+ */
+struct FPXRDPFrameSubmission
+{
+	uint64 TimestampNs = 0;
+	uint64 LeftEyeHandle = 0;
+	uint64 RightEyeHandle = 0;
+	uint32 FrameNumber = 0;
+	/** x, y, z, w exactly as the runtime consumes them */
+	float Rotation[4] = { 0.f, 0.f, 0.f, 1.f };
+	float Position[3] = { 0.f, 0.f, 0.f };
+	/** Tangents of the half angles: left, right, up, down */
+	float FovTangents[4] = { -1.f, 1.f, 1.f, -1.f };
+};
+
+/**
+ * Versioned binary encoding of FPXRDPFrameSubmission.
+ * Layout: uint32 Magic, uint16 Version, uint16 PayloadSize, then the payload fields in declaration order, little endian.
+ * A new version may only append fields, so a reader accepts any version whose payload is at least as large as its own.
+ */
+namespace PXRDPFrameMessage
+{
+	static constexpr uint32 Magic = 0x46445850; // "PXDF"
+	static constexpr uint16 Version = 1;
+	static constexpr int32 HeaderSize = sizeof(uint32) + 2 * sizeof(uint16);
+	static constexpr int32 PayloadSize = 3 * sizeof(uint64) + sizeof(uint32) + 11 * sizeof(float);
+	static constexpr int32 EncodedSize = HeaderSize + PayloadSize;
+
+	/** Describe string of the single kSubmitEyeLayer parameter carrying the encoded bytes */
+	static constexpr const char* ParameterDescribe = "frame";
+
+	static_assert(PLATFORM_LITTLE_ENDIAN, "The frame message is encoded with host byte order");
+
+	template<typename T>
+	FORCEINLINE uint8* Write(uint8* Out, const T& Value)
+	{
+		FMemory::Memcpy(Out, &Value, sizeof(T));
+		return Out + sizeof(T);
+	}
+
+	template<typename T>
+	FORCEINLINE const uint8* Read(const uint8* In, T& Value)
+	{
+		FMemory::Memcpy(&Value, In, sizeof(T));
+		return In + sizeof(T);
+	}
+
+	/** Writes EncodedSize bytes to Out and returns the number written */
+	inline int32 Encode(const FPXRDPFrameSubmission& Frame, uint8* Out)
+	{
+		uint8* Cursor = Out;
+		Cursor = Write(Cursor, Magic);
+		Cursor = Write(Cursor, Version);
+		Cursor = Write(Cursor, (uint16)PayloadSize);
+		Cursor = Write(Cursor, Frame.TimestampNs);
+		Cursor = Write(Cursor, Frame.LeftEyeHandle);
+		Cursor = Write(Cursor, Frame.RightEyeHandle);
+		Cursor = Write(Cursor, Frame.FrameNumber);
+		Cursor = Write(Cursor, Frame.Rotation);
+		Cursor = Write(Cursor, Frame.Position);
+		Cursor = Write(Cursor, Frame.FovTangents);
+		check(Cursor - Out == EncodedSize);
+		return EncodedSize;
+	}
+
+	/** Returns false if the bytes are not a frame message or are truncated */
+	inline bool Decode(const uint8* In, int32 NumBytes, FPXRDPFrameSubmission& OutFrame)
+	{
+		if (NumBytes < HeaderSize)
+		{
+			return false;
+		}
+		uint32 InMagic = 0;
+		uint16 InVersion = 0;
+		uint16 InPayloadSize = 0;
+		const uint8* Cursor = Read(In, InMagic);
+		Cursor = Read(Cursor, InVersion);
+		Cursor = Read(Cursor, InPayloadSize);
+		if (InMagic != Magic || InVersion < 1 || InPayloadSize < PayloadSize || HeaderSize + InPayloadSize > NumBytes)
+		{
+			return false;
+		}
+		Cursor = Read(Cursor, OutFrame.TimestampNs);
+		Cursor = Read(Cursor, OutFrame.LeftEyeHandle);
+		Cursor = Read(Cursor, OutFrame.RightEyeHandle);
+		Cursor = Read(Cursor, OutFrame.FrameNumber);
+		Cursor = Read(Cursor, OutFrame.Rotation);
+		Cursor = Read(Cursor, OutFrame.Position);
+		Read(Cursor, OutFrame.FovTangents);
+		return true;
+	}
+}
+
+/**
+ * Builds the string-keyed kSubmitEyeLayer parameters the current PICO runtime parses.
+ * The parameter list and its strings are kept between frames, so after the first frame only the values are rewritten in place.
+ */
+class FPXRDPLegacyFrameEncoder
+{
+public:
+	typedef pxr::connector::TerminalMessage::Parameter FParameter;
+
+	FPXRDPLegacyFrameEncoder()
+	{
+		static const char* const Describes[NumParameters] =
+		{
+			"rotation_x", "rotation_y", "rotation_z", "rotation_w", "position_x", "position_y", "position_z", "left_eye", "right_eye"
+		};
+		Parameters.resize(NumParameters);
+		for (int32 Index = 0; Index < NumParameters; Index++)
+		{
+			Parameters[Index].describe = Describes[Index];
+			Parameters[Index].type = Index < FirstHandle ? FParameter::Type::kFloat : FParameter::Type::kUInt64;
+		}
+	}
+
+	const std::vector<FParameter>& Encode(const FPXRDPFrameSubmission& Frame)
+	{
+		for (int32 Index = 0; Index < 4; Index++)
+		{
+			SetFloat(Index, Frame.Rotation[Index]);
+		}
+		for (int32 Index = 0; Index < 3; Index++)
+		{
+			SetFloat(4 + Index, Frame.Position[Index]);
+		}
+		SetUInt64(FirstHandle, Frame.LeftEyeHandle);
+		SetUInt64(FirstHandle + 1, Frame.RightEyeHandle);
+		return Parameters;
+	}
+
+	/** Parses parameters in the layout Encode writes; fields the string message does not carry are left untouched */
+	static bool Decode(const std::vector<FParameter>& InParameters, FPXRDPFrameSubmission& OutFrame)
+	{
+		if (InParameters.size() != NumParameters)
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < 4; Index++)
+		{
+			OutFrame.Rotation[Index] = FCStringAnsi::Atof(InParameters[Index].parameter.c_str());
+		}
+		for (int32 Index = 0; Index < 3; Index++)
+		{
+			OutFrame.Position[Index] = FCStringAnsi::Atof(InParameters[4 + Index].parameter.c_str());
+		}
+		OutFrame.LeftEyeHandle = FCStringAnsi::Strtoui64(InParameters[FirstHandle].parameter.c_str(), nullptr, 10);
+		OutFrame.RightEyeHandle = FCStringAnsi::Strtoui64(InParameters[FirstHandle + 1].parameter.c_str(), nullptr, 10);
+		return true;
+	}
+
+private:
+	static constexpr int32 NumParameters = 9;
+	static constexpr int32 FirstHandle = 7;
+
+	// Same text std::to_string produced, short enough to stay in the strings' existing storage
+	void SetFloat(int32 Index, float Value)
+	{
+		ANSICHAR Buffer[64];
+		const int32 Length = FCStringAnsi::Snprintf(Buffer, sizeof(Buffer), "%f", Value);
+		Parameters[Index].parameter.assign(Buffer, FMath::Clamp(Length, 0, (int32)sizeof(Buffer) - 1));
+	}
+
+	void SetUInt64(int32 Index, uint64 Value)
+	{
+		ANSICHAR Buffer[32];
+		const int32 Length = FCStringAnsi::Snprintf(Buffer, sizeof(Buffer), "%llu", (unsigned long long)Value);
+		Parameters[Index].parameter.assign(Buffer, FMath::Clamp(Length, 0, (int32)sizeof(Buffer) - 1));
+	}
+
+	std::vector<FParameter> Parameters;
+};
@@ -0,0 +1,220 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include <string>
+#include "HAL/IConsoleManager.h"
+#include "PXR_Benchmark.h"
+#include "PXR_CountingMalloc.h"
+#include "PXR_DPFrameMessage.h"
+
+// Round-trip encode/decode benchmark of the direct preview frame submission message. Needs no device or runtime.
+// Each path builds the kSubmitEyeLayer TerminalMessage, reads the parameters back out of it and parses them, and must get
+// the frame back: the string paths within the six decimals std::to_string keeps, the binary path exactly.
+
+namespace PXRDPFrameMessageBenchmark
+{
+	using namespace pxr::connector;
+
+	struct FPathStats
+	{
+		const TCHAR* Name = nullptr;
+		float MaxErrorTolerance = 0.f;
+		uint64 Cycles = 0;
+		uint64 Allocations = 0;
+		uint64 AllocatedBytes = 0;
+		uint64 PayloadBytes = 0;
+		float MaxError = 0.f;
+		uint32 HandleMismatches = 0;
+	};
+
+	static FPXRDPFrameSubmission MakeFrame(uint32 FrameNumber)
+	{
+		const float Time = FrameNumber / 90.f;
+		const FQuat Rotation(FRotator(FMath::Sin(Time) * 30.f, Time * 20.f, FMath::Cos(Time * 0.5f) * 10.f));
+		FPXRDPFrameSubmission Frame;
+		Frame.FrameNumber = FrameNumber;
+		Frame.TimestampNs = (uint64)FrameNumber * 11111111ull;
+		Frame.Rotation[0] = Rotation.X;
+		Frame.Rotation[1] = Rotation.Y;
+		Frame.Rotation[2] = Rotation.Z;
+		Frame.Rotation[3] = -Rotation.W;
+		Frame.Position[0] = FMath::Sin(Time * 1.3f) * 0.2f;
+		Frame.Position[1] = 1.6f + FMath::Sin(Time * 2.1f) * 0.05f;
+		Frame.Position[2] = FMath::Cos(Time * 0.7f) * 0.3f;
+		Frame.LeftEyeHandle = 0x40000000ull + FrameNumber;
+		Frame.RightEyeHandle = 0x40000100ull + FrameNumber;
+		return Frame;
+	}
+
+	static void Compare(const FPXRDPFrameSubmission& Expected, const FPXRDPFrameSubmission& Actual, FPathStats& Stats)
+	{
+		for (int32 Index = 0; Index < 4; Index++)
+		{
+			Stats.MaxError = FMath::Max(Stats.MaxError, FMath::Abs(Expected.Rotation[Index] - Actual.Rotation[Index]));
+		}
+		for (int32 Index = 0; Index < 3; Index++)
+		{
+			Stats.MaxError = FMath::Max(Stats.MaxError, FMath::Abs(Expected.Position[Index] - Actual.Position[Index]));
+		}
+		if (Expected.LeftEyeHandle != Actual.LeftEyeHandle || Expected.RightEyeHandle != Actual.RightEyeHandle)
+		{
+			Stats.HandleMismatches++;
+		}
+	}
+
+	static uint64 ParameterBytes(const std::vector<TerminalMessage::Parameter>& Parameters)
+	{
+		uint64 Size = 0;
+		for (const TerminalMessage::Parameter& Parameter : Parameters)
+		{
+			Size += Parameter.describe.size() + Parameter.parameter.size() + sizeof(Parameter.type);
+		}
+		return Size;
+	}
+
+	/** What DP::SendMessage used to do every frame: a fresh parameter list with std::to_string values */
+	static void PushPerFrameStrings(const FPXRDPFrameSubmission& Frame, TerminalMessage& OutMessage)
+	{
+		std::vector<TerminalMessage::Parameter> Parameters;
+		TerminalMessage::Parameter Parameter;
+		static const char* const FloatDescribes[7] = { "rotation_x", "rotation_y", "rotation_z", "rotation_w", "position_x", "position_y", "position_z" };
+		const float FloatValues[7] = { Frame.Rotation[0], Frame.Rotation[1], Frame.Rotation[2], Frame.Rotation[3], Frame.Position[0], Frame.Position[1], Frame.Position[2] };
+		for (int32 Index = 0; Index < 7; Index++)
+		{
+			Parameter.describe = FloatDescribes[Index];
+			Parameter.parameter = std::to_string(FloatValues[Index]);
+			Parameter.type = TerminalMessage::Parameter::Type::kFloat;
+			Parameters.push_back(Parameter);
+		}
+		Parameter.describe = "left_eye";
+		Parameter.parameter = std::to_string(Frame.LeftEyeHandle);
+		Parameter.type = TerminalMessage::Parameter::Type::kUInt64;
+		Parameters.push_back(Parameter);
+		Parameter.describe = "right_eye";
+		Parameter.parameter = std::to_string(Frame.RightEyeHandle);
+		Parameter.type = TerminalMessage::Parameter::Type::kUInt64;
+		Parameters.push_back(Parameter);
+
+		TerminalMessage Message;
+		Message.SetType_(TerminalMessage::Type::kSubmitEyeLayer);
+		Message.SetParameters(Parameters);
+		OutMessage = Message;
+	}
+
+	template<typename FuncType>
+	static void Measure(FPXRCountingMalloc* Counter, bool bRecording, FPathStats& Stats, FuncType&& Func)
+	{
+		const int64 AllocationsBefore = Counter->Allocations.GetValue();
+		const int64 BytesBefore = Counter->AllocatedBytes.GetValue();
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Func();
+		const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+		if (bRecording)
+		{
+			Stats.Cycles += Cycles;
+			Stats.Allocations += Counter->Allocations.GetValue() - AllocationsBefore;
+			Stats.AllocatedBytes += Counter->AllocatedBytes.GetValue() - BytesBefore;
+		}
+	}
+
+	static void Execute(const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+	{
+		FPXRBenchmark Benchmark(TEXT("pxr.DP.BenchmarkFrameMessage"), Args, Ar);
+		const int32 NumFrames = FMath::Max(Benchmark.Param(TEXT("Frames="), 100000), 1);
+		const int32 NumWarmupFrames = Benchmark.Param(TEXT("Warmup="), 1000);
+
+		enum { Path_PerFrameStrings, Path_ReusedStrings, Path_Binary, Path_Count };
+		FPathStats Stats[Path_Count];
+		Stats[Path_PerFrameStrings].Name = TEXT("string parameters, rebuilt per frame");
+		Stats[Path_ReusedStrings].Name = TEXT("string parameters, reused storage");
+		Stats[Path_Binary].Name = TEXT("binary v1");
+		Stats[Path_PerFrameStrings].MaxErrorTolerance = 1e-5f;
+		Stats[Path_ReusedStrings].MaxErrorTolerance = 1e-5f;
+
+		// State the submit thread keeps between frames
+		TerminalMessage Message;
+		Message.SetType_(TerminalMessage::Type::kSubmitEyeLayer);
+		std::vector<TerminalMessage::Parameter> ReceivedParameters;
+		FPXRDPLegacyFrameEncoder LegacyEncoder;
+		std::vector<TerminalMessage::Parameter> BinaryParameters(1);
+		BinaryParameters[0].describe = PXRDPFrameMessage::ParameterDescribe;
+		BinaryParameters[0].type = TerminalMessage::Parameter::Type::kString;
+		uint8 EncodedFrame[PXRDPFrameMessage::EncodedSize];
+
+		FPXRCountingMalloc::FScope CountingScope;
+		for (int32 FrameIndex = 0; FrameIndex < NumWarmupFrames + NumFrames; FrameIndex++)
+		{
+			const bool bRecording = FrameIndex >= NumWarmupFrames;
+			const FPXRDPFrameSubmission Frame = MakeFrame(FrameIndex);
+			FPXRDPFrameSubmission Decoded[Path_Count];
+
+			Measure(CountingScope.Counter, bRecording, Stats[Path_PerFrameStrings], [&]()
+			{
+				PushPerFrameStrings(Frame, Message);
+				std::vector<TerminalMessage::Parameter> Parameters;
+				Message.GetParameters(Parameters);
+				FPXRDPLegacyFrameEncoder::Decode(Parameters, Decoded[Path_PerFrameStrings]);
+			});
+
+			Measure(CountingScope.Counter, bRecording, Stats[Path_ReusedStrings], [&]()
+			{
+				Message.SetParameters(LegacyEncoder.Encode(Frame));
+				Message.GetParameters(ReceivedParameters);
+				FPXRDPLegacyFrameEncoder::Decode(ReceivedParameters, Decoded[Path_ReusedStrings]);
+			});
+			if (bRecording)
+			{
+				// Both string paths produce the same text
+				Stats[Path_ReusedStrings].PayloadBytes += ParameterBytes(ReceivedParameters);
+				Stats[Path_PerFrameStrings].PayloadBytes += ParameterBytes(ReceivedParameters);
+			}
+
+			Measure(CountingScope.Counter, bRecording, Stats[Path_Binary], [&]()
+			{
+				const int32 NumBytes = PXRDPFrameMessage::Encode(Frame, EncodedFrame);
+				BinaryParameters[0].parameter.assign((const char*)EncodedFrame, NumBytes);
+				Message.SetParameters(BinaryParameters);
+				Message.GetParameters(ReceivedParameters);
+				const std::string& Received = ReceivedParameters[0].parameter;
+				PXRDPFrameMessage::Decode((const uint8*)Received.data(), (int32)Received.size(), Decoded[Path_Binary]);
+			});
+			if (bRecording)
+			{
+				Stats[Path_Binary].PayloadBytes += ParameterBytes(ReceivedParameters);
+				for (int32 Path = 0; Path < Path_Count; Path++)
+				{
+					Compare(Frame, Decoded[Path], Stats[Path]);
+				}
+			}
+		}
+
+		Ar.Logf(TEXT("PICOXR direct preview frame message benchmark: %d frames (+%d warmup), encode + TerminalMessage copy + decode"), NumFrames, NumWarmupFrames);
+		Ar.Logf(TEXT("%-40s %10s %12s %12s %12s %12s %10s"), TEXT("Path"), TEXT("Avg ns"), TEXT("Allocs/frm"), TEXT("Bytes/frm"), TEXT("Payload B"), TEXT("Max error"), TEXT("Bad IDs"));
+		for (const FPathStats& PathStats : Stats)
+		{
+			Ar.Logf(TEXT("%-40s %10.1f %12.2f %12.0f %12.0f %12g %10u"), PathStats.Name,
+				FPXRBenchmark::AverageNanoseconds(PathStats.Cycles, NumFrames),
+				(double)PathStats.Allocations / NumFrames,
+				(double)PathStats.AllocatedBytes / NumFrames,
+				(double)PathStats.PayloadBytes / NumFrames,
+				PathStats.MaxError,
+				PathStats.HandleMismatches);
+		}
+		for (const FPathStats& PathStats : Stats)
+		{
+			Benchmark.Check(PathStats.MaxError <= PathStats.MaxErrorTolerance, TEXT("%s: pose differs by up to %g"), PathStats.Name, PathStats.MaxError);
+			Benchmark.Check(PathStats.HandleMismatches == 0, TEXT("%s: %u frames came back with other eye layer handles"), PathStats.Name, PathStats.HandleMismatches);
+		}
+		Benchmark.Finish();
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchmarkCommand(
+		TEXT("pxr.DP.BenchmarkFrameMessage"),
+		TEXT("Round-trips synthetic direct preview frame submissions through the string and binary encodings, reports CPU time and allocations, and fails when a path does not return the frame it was given.\n")
+		TEXT("Params: Frames= Warmup="),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Execute));
+}
+
+#endif
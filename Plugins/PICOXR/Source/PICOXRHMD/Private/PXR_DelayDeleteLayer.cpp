@@ -3,6 +3,7 @@
 #include "PXR_DelayDeleteLayer.h"
 #include "XRThreadUtils.h"
 #include "PXR_Log.h"
+#include "PXR_MockRuntime.h"
 #if PLATFORM_ANDROID
 #include "PxrApi.h"
 #endif
@@ -50,6 +51,8 @@ void FDelayDeleteLayerManager::HandleLayerDeferredDeletionQueue_RenderThread(boo
 					PXR_LOGV(PxrUnreal, "Destroying layer %d", PxrLayerId);
 #if PLATFORM_ANDROID
 					Pxr_DestroyLayer(PxrLayerId);
+#elif PICOXR_MOCK_RUNTIME
+					FPXRMockRuntime::Get().DestroyLayer(PxrLayerId);
 #endif
 				});
 				DeferredDeletionArray.RemoveAtSwap(Index, 1, false);
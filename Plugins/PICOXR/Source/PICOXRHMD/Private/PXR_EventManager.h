@@ -6,6 +6,8 @@
 #include "Delegates/Delegate.h"
 #include "PXR_EventManager.generated.h"
 
+class UTexture2D;
+
 //ControllerDelegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPXRDeviceMainChangedDelegate,int32,Handness);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FPXRDeviceConnectChangedDelegate,int32,Handness,int32,State);
@@ -16,6 +18,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FPXRResume);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPXRIpdChanged,float,NewIpd);
 //SystemDisplayRateDelegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPXRRefreshRateChanged, float, NewRate);
+//SeeThroughDelegate
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FPXRSeeThroughFrameReady, int32, CameraType, UTexture2D*, CameraImage);
 UCLASS()
 class UPICOXREventManager : public UObject
 {
@@ -44,4 +48,8 @@ public:
 
 	UPROPERTY(BlueprintAssignable)
 	FPXRInputDeviceChangedDelegate InputDeviceChangedDelegate;
+
+	/** Fires when the runtime wrote a new image of a camera requested through PXR_GetBoundarySeeThroughData */
+	UPROPERTY(BlueprintAssignable)
+	FPXRSeeThroughFrameReady SeeThroughFrameReadyDelegate;
 };
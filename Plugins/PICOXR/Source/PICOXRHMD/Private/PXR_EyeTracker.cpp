@@ -6,6 +6,7 @@
 #include "Engine/Engine.h"
 #include "GameFramework/HUD.h"
 #include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
 
 #if PLATFORM_ANDROID
 #include "Android/AndroidApplication.h"
@@ -18,9 +19,6 @@ FPICOXREyeTracker::FPICOXREyeTracker()
     ,bFaceTrackingRun(false)
 {
     FMemory::Memzero(TrackerData);
-#if PLATFORM_ANDROID
-	FMemory::Memzero(faceTrackingData);
-#endif
 }
 
 FPICOXREyeTracker::~FPICOXREyeTracker()
@@ -29,9 +27,23 @@ FPICOXREyeTracker::~FPICOXREyeTracker()
 
 bool FPICOXREyeTracker::Tick(float DeltaTime)
 {
+    const double Now = FPlatformTime::Seconds();
     if (bEyeTrackingRun)
     {
         GetEyeTrackingDataFromDevice(TrackerData);
+        FPXREyeTrackingSample EyeSample;
+        EyeSample.TimeSeconds = Now;
+        EyeSample.Data = TrackerData;
+        EyeTrackingHistory.Push(EyeSample);
+    }
+    if (bFaceTrackingRun)
+    {
+        FPXRFaceTrackingSample FaceSample;
+        if (ReadFaceTrackingSample(0, FaceSample))
+        {
+            FaceSample.TimeSeconds = Now;
+            FaceTrackingHistory.Push(FaceSample);
+        }
     }
     return true;
 }
@@ -221,16 +233,15 @@ bool FPICOXREyeTracker::GetEyeDirectionToFoveationRendering(FVector& OutDirectio
 	return false;
 }
 
-bool FPICOXREyeTracker::GetFaceTrackingData(int64 inTimeStamp, int64& outTimeStamp, TArray<float>& blendShapeWeight, TArray<float>& videoInputValid, float &laughingProb, TArray<float>& emotionProb, TArray<float>& reserved)
+bool FPICOXREyeTracker::ReadFaceTrackingSample(int64 InTimeStamp, FPXRFaceTrackingSample& OutSample)
 {
 	UPICOXRSettings* Settings = GetMutableDefault<UPICOXRSettings>();
 	if (Settings && bFaceTrackingRun)
 	{
-		int64_t pxrTs = inTimeStamp;
-		int pxrFlags = 0;
-		int BSN = 72;
 #if PLATFORM_ANDROID
-		BSN = BLEND_SHAPE_NUMS;
+		static_assert(BLEND_SHAPE_NUMS == FPXRFaceTrackingSample::NumBlendShapes, "FPXRFaceTrackingSample does not match PxrFTInfo");
+		int64_t pxrTs = InTimeStamp;
+		int pxrFlags = 0;
 		switch (Settings->FaceTrackingMode)
 		{
 		case EPICOXRFaceTrackingMode::Disable:
@@ -248,25 +259,50 @@ bool FPICOXREyeTracker::GetFaceTrackingData(int64 inTimeStamp, int64& outTimeSta
 		default:
 			break;
 		}
-#endif
-		blendShapeWeight.SetNum(BSN);
-        videoInputValid.SetNum(10);
-        emotionProb.SetNum(10);
-		reserved.SetNum(128);
-#if PLATFORM_ANDROID
+		PxrFTInfo faceTrackingData;
 		Pxr_GetFaceTrackingData(pxrTs, pxrFlags, &faceTrackingData);
-        outTimeStamp = faceTrackingData.timestamp;
-		laughingProb = faceTrackingData.laughingProb;
-		FMemory::Memcpy(blendShapeWeight.GetData(), faceTrackingData.blendShapeWeight, sizeof(float) * BSN);
-		FMemory::Memcpy(videoInputValid.GetData(), faceTrackingData.videoInputValid, sizeof(float) * 10);
-		FMemory::Memcpy(emotionProb.GetData(), faceTrackingData.emotionProb, sizeof(float) * 10);
-		FMemory::Memcpy(reserved.GetData(), faceTrackingData.reserved, sizeof(float) * 128);
+		OutSample.RuntimeTimestamp = faceTrackingData.timestamp;
+		OutSample.LaughingProb = faceTrackingData.laughingProb;
+		FMemory::Memcpy(OutSample.BlendShapeWeight, faceTrackingData.blendShapeWeight, sizeof(OutSample.BlendShapeWeight));
+		FMemory::Memcpy(OutSample.VideoInputValid, faceTrackingData.videoInputValid, sizeof(OutSample.VideoInputValid));
+		FMemory::Memcpy(OutSample.EmotionProb, faceTrackingData.emotionProb, sizeof(OutSample.EmotionProb));
+		FMemory::Memcpy(OutSample.Reserved, faceTrackingData.reserved, sizeof(OutSample.Reserved));
+#else
+		FMemory::Memzero(OutSample);
 #endif
+		OutSample.TimeSeconds = FPlatformTime::Seconds();
 		return true;
 	}
 	return false;
 }
 
+bool FPICOXREyeTracker::GetFaceTrackingData(int64 inTimeStamp, int64& outTimeStamp, TArray<float>& blendShapeWeight, TArray<float>& videoInputValid, float &laughingProb, TArray<float>& emotionProb, TArray<float>& reserved)
+{
+	if (!bFaceTrackingRun)
+	{
+		return false;
+	}
+	// 0 asks for the newest reading, which this frame's tick already read
+	FPXRFaceTrackingSample Sample;
+	const bool bHasSample = inTimeStamp == 0 && FaceTrackingHistory.GetLatest(Sample);
+	if (!bHasSample && !ReadFaceTrackingSample(inTimeStamp, Sample))
+	{
+		return false;
+	}
+	// Arrays passed back in from the previous call keep their storage
+	outTimeStamp = Sample.RuntimeTimestamp;
+	laughingProb = Sample.LaughingProb;
+	blendShapeWeight.SetNumUninitialized(FPXRFaceTrackingSample::NumBlendShapes, false);
+	videoInputValid.SetNumUninitialized(FPXRFaceTrackingSample::NumVideoInputs, false);
+	emotionProb.SetNumUninitialized(FPXRFaceTrackingSample::NumEmotions, false);
+	reserved.SetNumUninitialized(FPXRFaceTrackingSample::NumReserved, false);
+	FMemory::Memcpy(blendShapeWeight.GetData(), Sample.BlendShapeWeight, sizeof(Sample.BlendShapeWeight));
+	FMemory::Memcpy(videoInputValid.GetData(), Sample.VideoInputValid, sizeof(Sample.VideoInputValid));
+	FMemory::Memcpy(emotionProb.GetData(), Sample.EmotionProb, sizeof(Sample.EmotionProb));
+	FMemory::Memcpy(reserved.GetData(), Sample.Reserved, sizeof(Sample.Reserved));
+	return true;
+}
+
 bool FPICOXREyeTracker::EnableEyeTracking(bool enable)
 {
 	UPICOXRSettings* Settings = GetMutableDefault<UPICOXRSettings>();
@@ -294,6 +330,7 @@ bool FPICOXREyeTracker::EnableEyeTracking(bool enable)
     			if (Pxr_SetTrackingMode(TargetTrackingMode) == 0)
     			{
     				bEyeTrackingRun = enable;
+    				EyeTrackingHistory.Reset();
                     CurrentTrackingMode = TargetTrackingMode;
                     Settings->bEnableEyeTracking = enable;
     				FString EyeTrackingLog=enable? "Enable Succeeded!": "Disable Succeeded!";
@@ -307,6 +344,7 @@ bool FPICOXREyeTracker::EnableEyeTracking(bool enable)
     		if (Pxr_SetTrackingMode(TargetTrackingMode) == 0)
     		{
     			bEyeTrackingRun = enable;
+    			EyeTrackingHistory.Reset();
                 CurrentTrackingMode = TargetTrackingMode;
                 Settings->bEnableEyeTracking = enable;
     			FString EyeTrackingLog=enable? "Enable Succeeded!": "Disable Succeeded!";
@@ -365,6 +403,7 @@ bool FPICOXREyeTracker::EnableFaceTracking(EPICOXRFaceTrackingMode mode)
                     bFaceTrackingRun = true;
                 }
 				CurrentTrackingMode = TargetTrackingMode;
+				FaceTrackingHistory.Reset();
 				UE_LOG(LogHMD, Log, TEXT("Face Tracking Mode:%u"), CurrentTrackingMode);
                 return true;
             }
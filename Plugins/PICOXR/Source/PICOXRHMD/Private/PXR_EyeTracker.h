@@ -5,6 +5,7 @@
 #include "PXR_HMDFunctionLibrary.h"
 #include "Containers/Ticker.h"
 #include "EyeTracker/Public/IEyeTracker.h"
+#include "PXR_TrackingHistory.h"
 
 #if PLATFORM_ANDROID
 #include <PxrTypes.h>
@@ -33,6 +34,10 @@ struct FPICOXREyeTrackingGazeRay
 class FPICOXREyeTracker : public IEyeTracker, public FTickerObjectBase
 {
 public:
+	/** About 0.7 s at 90 Hz, enough to interpolate behind network or animation latency */
+	typedef TPXRTrackingHistory<FPXREyeTrackingSample, 64> FEyeTrackingHistory;
+	typedef TPXRTrackingHistory<FPXRFaceTrackingSample, 64> FFaceTrackingHistory;
+
 	FPICOXREyeTracker();
 	virtual ~FPICOXREyeTracker();
 	virtual bool Tick(float DeltaTime) override;
@@ -61,14 +66,20 @@ public:
 	bool EnableEyeTracking(bool enable);
 	bool EnableFaceTracking(EPICOXRFaceTrackingMode mode);
 
+	/** Written once per frame while eye tracking runs */
+	const FEyeTrackingHistory& GetEyeTrackingHistory() const { return EyeTrackingHistory; }
+	/** Written once per frame while face tracking runs */
+	const FFaceTrackingHistory& GetFaceTrackingHistory() const { return FaceTrackingHistory; }
+
 private:
+	bool ReadFaceTrackingSample(int64 InTimeStamp, FPXRFaceTrackingSample& OutSample);
+
 	TWeakObjectPtr<APlayerController> ActivePlayerController;
 	FPICOXREyeTrackingData TrackerData;
 	bool bEyeTrackingRun;
 	bool bFaceTrackingRun;
 	static TSharedPtr<FPICOXREyeTracker> EyeTrackerPtr;
 	uint32 CurrentTrackingMode = 0x00000002;//PXR_TRACKING_MODE_POSITION_BIT PxrTypes.h
-#if PLATFORM_ANDROID
-	PxrFTInfo faceTrackingData;
-#endif
+	FEyeTrackingHistory EyeTrackingHistory;
+	FFaceTrackingHistory FaceTrackingHistory;
 };
\ No newline at end of file
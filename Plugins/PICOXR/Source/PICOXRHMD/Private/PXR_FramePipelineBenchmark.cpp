@@ -0,0 +1,232 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if PICOXR_MOCK_RUNTIME
+#include "HAL/IConsoleManager.h"
+#include "RenderingThread.h"
+#include "XRThreadUtils.h"
+#include "Engine/Engine.h"
+#include "PXR_HMD.h"
+#include "PXR_MockRuntime.h"
+#include "PXR_Benchmark.h"
+#include "PXR_CountingMalloc.h"
+#include "PXR_Log.h"
+
+// Headless frame-pipeline benchmark, run with the mock runtime (-pxrmock).
+// Each stage is run to completion before the next one starts, so the allocation counts can be attributed to it. Every frame
+// must reach the runtime balanced, and every layer must be created while there are no more than MaxLayers of them.
+
+namespace PXRFramePipelineBenchmark
+{
+	enum EStage
+	{
+		Stage_GameFrameBegin,
+		Stage_RenderFrameBegin_GameThread,
+		Stage_RenderFrameBegin_RenderThread,
+		Stage_GameFrameEnd,
+		Stage_LateUpdate,
+		Stage_RHIFrameBegin,
+		Stage_RenderFrameEnd,
+		Stage_RHIFrameEnd,
+		Stage_FlushBaseline,
+		Stage_Count
+	};
+
+	static const TCHAR* StageNames[Stage_Count] =
+	{
+		TEXT("OnGameFrameBegin_GameThread (WaitFrame)"),
+		TEXT("OnRenderFrameBegin_GameThread"),
+		TEXT("OnRenderFrameBegin render command + flush"),
+		TEXT("OnGameFrameEnd_GameThread"),
+		TEXT("LateUpdatePose"),
+		TEXT("OnRHIFrameBegin_RenderThread"),
+		TEXT("OnRenderFrameEnd_RenderThread"),
+		TEXT("OnRHIFrameEnd_RHIThread"),
+		TEXT("FlushRenderingCommands (baseline)"),
+	};
+
+	struct FStageStats
+	{
+		uint64 TotalCycles = 0;
+		uint64 MaxCycles = 0;
+		uint64 Allocations = 0;
+		uint64 AllocatedBytes = 0;
+	};
+
+	struct FRun
+	{
+		FStageStats Stages[Stage_Count];
+		FPXRCountingMalloc* Counter = nullptr;
+		bool bRecording = false;
+
+		template<typename FuncType>
+		void Measure(EStage Stage, FuncType&& Func)
+		{
+			const int64 AllocationsBefore = Counter->Allocations.GetValue();
+			const int64 BytesBefore = Counter->AllocatedBytes.GetValue();
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Func();
+			const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+			if (bRecording)
+			{
+				FStageStats& StageStats = Stages[Stage];
+				StageStats.TotalCycles += Cycles;
+				StageStats.MaxCycles = FMath::Max(StageStats.MaxCycles, Cycles);
+				StageStats.Allocations += Counter->Allocations.GetValue() - AllocationsBefore;
+				StageStats.AllocatedBytes += Counter->AllocatedBytes.GetValue() - BytesBefore;
+			}
+		}
+	};
+
+	static IStereoLayers::FLayerDesc MakeLayerDesc(int32 Index, float Offset)
+	{
+		IStereoLayers::FLayerDesc LayerDesc;
+#if ENGINE_MINOR_VERSION > 24
+		if (Index % 2)
+		{
+			LayerDesc.SetShape<FCylinderLayer>();
+		}
+		else
+		{
+			LayerDesc.SetShape<FQuadLayer>();
+		}
+#else
+		LayerDesc.ShapeType = (Index % 2) ? IStereoLayers::CylinderLayer : IStereoLayers::QuadLayer;
+#endif
+		LayerDesc.Priority = Index;
+		LayerDesc.QuadSize = FVector2D(64.0f, 64.0f);
+		LayerDesc.LayerSize = FIntPoint(256, 256);
+		LayerDesc.PositionType = (Index % 3) ? IStereoLayers::WorldLocked : IStereoLayers::FaceLocked;
+		LayerDesc.Transform = FTransform(FVector(200.0f, Index * 10.0f + Offset, 0.0f));
+		return LayerDesc;
+	}
+
+	static FPICOXRHMD* GetPICOXRHMD()
+	{
+		if (GEngine && GEngine->XRSystem.IsValid() && GEngine->XRSystem->GetSystemName() == FName(TEXT("PICOXRHMD")))
+		{
+			return static_cast<FPICOXRHMD*>(GEngine->XRSystem.Get());
+		}
+		return nullptr;
+	}
+
+	static void RunFrame(FPICOXRHMD* HMD, FRun& Run)
+	{
+		Run.Measure(Stage_GameFrameBegin, [HMD]() { HMD->OnGameFrameBegin_GameThread(); });
+		if (HMD->NextGameFrameToRender_GameThread.IsValid())
+		{
+			// What BeginRenderViewFamily copies from the view family
+			HMD->NextGameFrameToRender_GameThread->ShowFlags.SetRendering(true);
+		}
+		Run.Measure(Stage_RenderFrameBegin_GameThread, [HMD]() { HMD->OnRenderFrameBegin_GameThread(); });
+		Run.Measure(Stage_RenderFrameBegin_RenderThread, []() { FlushRenderingCommands(); });
+		Run.Measure(Stage_GameFrameEnd, [HMD]() { HMD->OnGameFrameEnd_GameThread(); });
+
+		FRun* RunPtr = &Run;
+		ENQUEUE_RENDER_COMMAND(PXRBenchmarkRenderFrame)([HMD, RunPtr](FRHICommandListImmediate& RHICmdList)
+			{
+				RunPtr->Measure(Stage_LateUpdate, [HMD]() { HMD->LateUpdatePose(); });
+				RunPtr->Measure(Stage_RHIFrameBegin, [HMD]() { HMD->OnRHIFrameBegin_RenderThread(); });
+				RunPtr->Measure(Stage_RenderFrameEnd, [HMD, &RHICmdList]() { HMD->OnRenderFrameEnd_RenderThread(RHICmdList); });
+				ExecuteOnRHIThread([HMD, RunPtr]()
+					{
+						RunPtr->Measure(Stage_RHIFrameEnd, [HMD]() { HMD->OnRHIFrameEnd_RHIThread(); });
+					});
+			});
+		FlushRenderingCommands();
+		Run.Measure(Stage_FlushBaseline, []() { FlushRenderingCommands(); });
+	}
+
+	static void Execute(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		FPXRBenchmark Benchmark(TEXT("pxr.Mock.BenchmarkFramePipeline"), Args, Ar);
+		FPICOXRHMD* HMD = GetPICOXRHMD();
+		if (!Benchmark.Check(HMD != nullptr, TEXT("PICOXRHMD is not the active XR system, start with -pxrmock")))
+		{
+			Benchmark.Finish();
+			return;
+		}
+
+		const int32 NumFrames = Benchmark.Param(TEXT("Frames="), 5000);
+		const int32 NumWarmupFrames = Benchmark.Param(TEXT("Warmup="), 120);
+		const int32 NumLayers = Benchmark.Param(TEXT("Layers="), 16);
+		const int32 UpdateEvery = Benchmark.Param(TEXT("UpdateEvery="), 8);
+
+		FPXRMockRuntimeConfig Config = FPXRMockRuntime::Get().GetConfig();
+		Config.DisplayRefreshRate = Benchmark.Param(TEXT("RefreshRate="), Config.DisplayRefreshRate);
+		Config.SensorLatencyMs = Benchmark.Param(TEXT("SensorLatencyMs="), Config.SensorLatencyMs);
+		Config.MaxLayerCount = Benchmark.Param(TEXT("MaxLayers="), Config.MaxLayerCount);
+		FPXRMockRuntime::Get().Configure(Config);
+
+		// The engine loop drives the same entry points, keep it from interleaving frames with ours
+		FlushRenderingCommands();
+		HMD->OnGameFrameEnd_GameThread();
+
+		TArray<uint32> LayerIds;
+		for (int32 LayerIndex = 0; LayerIndex < NumLayers; LayerIndex++)
+		{
+			LayerIds.Add(HMD->CreateLayer(MakeLayerDesc(LayerIndex, 0.0f)));
+		}
+
+		// Counts until the end of this function, only the recorded frames are attributed
+		FPXRCountingMalloc::FScope CountingScope;
+
+		FRun* Run = new FRun();
+		Run->Counter = CountingScope.Counter;
+		const int32 TotalFrames = NumWarmupFrames + NumFrames;
+		for (int32 Frame = 0; Frame < TotalFrames; Frame++)
+		{
+			if (Frame == NumWarmupFrames)
+			{
+				FPXRMockRuntime::Get().ResetStats();
+				Run->bRecording = true;
+			}
+			if (UpdateEvery > 0 && LayerIds.Num() > 0 && Frame % UpdateEvery == 0)
+			{
+				const int32 LayerIndex = (Frame / UpdateEvery) % LayerIds.Num();
+				HMD->SetLayerDesc(LayerIds[LayerIndex], MakeLayerDesc(LayerIndex, (float)(Frame % 100)));
+			}
+			RunFrame(HMD, *Run);
+		}
+
+		for (uint32 LayerId : LayerIds)
+		{
+			HMD->DestroyLayer(LayerId);
+		}
+
+		const FPXRMockRuntimeStats MockStats = FPXRMockRuntime::Get().GetStats();
+		const double FramesDivisor = FMath::Max(NumFrames, 1);
+		Ar.Logf(TEXT("PICOXR frame pipeline benchmark: %d frames (+%d warmup), %d layers, one layer updated every %d frames, %.1fHz, %.2fms sensor latency"),
+			NumFrames, NumWarmupFrames, NumLayers, UpdateEvery, Config.DisplayRefreshRate, Config.SensorLatencyMs);
+		Ar.Logf(TEXT("%-45s %12s %12s %12s %12s"), TEXT("Stage"), TEXT("Avg us"), TEXT("Max us"), TEXT("Allocs/frm"), TEXT("Bytes/frm"));
+		for (int32 Stage = 0; Stage < Stage_Count; Stage++)
+		{
+			const FStageStats& StageStats = Run->Stages[Stage];
+			Ar.Logf(TEXT("%-45s %12.2f %12.2f %12.2f %12.0f"), StageNames[Stage],
+				FPXRBenchmark::AverageNanoseconds(StageStats.TotalCycles, NumFrames) / 1000.0,
+				FPlatformTime::ToMilliseconds64(StageStats.MaxCycles) * 1000.0,
+				StageStats.Allocations / FramesDivisor,
+				StageStats.AllocatedBytes / FramesDivisor);
+		}
+		Ar.Logf(TEXT("Runtime: waited %llu, begun %llu, ended %llu, unbalanced %llu, submitted %llu layers, created %llu, destroyed %llu, create failures %llu, peak live layers %d"),
+			MockStats.FramesWaited, MockStats.FramesBegun, MockStats.FramesEnded, MockStats.UnbalancedFrames, MockStats.LayersSubmitted,
+			MockStats.LayersCreated, MockStats.LayersDestroyed, MockStats.LayerCreateFailures, MockStats.PeakLiveLayers);
+		delete Run;
+
+		Benchmark.Check(MockStats.UnbalancedFrames == 0, TEXT("%llu frames began or ended out of order"), MockStats.UnbalancedFrames);
+		if (NumLayers <= Config.MaxLayerCount)
+		{
+			Benchmark.Check(MockStats.LayerCreateFailures == 0, TEXT("%llu layers failed to create with %d of at most %d layers"), MockStats.LayerCreateFailures, NumLayers, Config.MaxLayerCount);
+		}
+		Benchmark.Finish();
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchmarkCommand(
+		TEXT("pxr.Mock.BenchmarkFramePipeline"),
+		TEXT("Drives synthetic frames through FPICOXRHMD against the mock runtime, reports per-stage CPU time and allocations, and fails on unbalanced frames or layer creation failures.\n")
+		TEXT("Params: Frames= Warmup= Layers= UpdateEvery= RefreshRate= SensorLatencyMs= MaxLayers="),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Execute));
+}
+
+#endif
@@ -1,5 +1,14 @@
 ﻿//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
 #include "PXR_GameFrame.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "PXR_Log.h"
+
+static TAutoConsoleVariable<int32> CVarPICOGameFrameStageStats(
+	TEXT("vr.PICO.GameFrameStageStats"),
+	0,
+	TEXT("Logs how long PICOXR game frames stay in the game, render and RHI stage, averaged over this many frames. 0 to disable."),
+	ECVF_Default);
 
 FPXRGameFrame::FPXRGameFrame()
 	: FrameNumber(0)
@@ -8,6 +17,8 @@ FPXRGameFrame::FPXRGameFrame()
 	, WorldToMetersScale(100)
 	, ShowFlags(ESFIM_All0)
 	, bHasWaited(false)
+	, FrameBeginTimeSeconds(0)
+	, StageBeginTimeSeconds(0)
 {
 	Flags.Raw = 0;
 	Position = FVector::ZeroVector;
@@ -23,3 +34,107 @@ TSharedPtr<FPXRGameFrame, ESPMode::ThreadSafe> FPXRGameFrame::CloneMyself() cons
 	TSharedPtr<FPXRGameFrame, ESPMode::ThreadSafe> NewFrame = MakeShareable(new FPXRGameFrame(*this));
 	return NewFrame;
 }
+
+void FPXRGameFramePool::FResidency::Add(double Seconds)
+{
+	TotalSeconds += Seconds;
+	MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+	NumFrames++;
+}
+
+FPXRGameFramePool::FPXRGameFramePool()
+{
+	for (int32 Stage = 0; Stage < (int32)EPXRGameFrameStage::Num; Stage++)
+	{
+		for (int32 Slot = 0; Slot < RingSize; Slot++)
+		{
+			Rings[Stage][Slot] = MakeShareable(new FPXRGameFrame());
+		}
+	}
+}
+
+FPXRGameFramePtr FPXRGameFramePool::AcquireSlot(EPXRGameFrameStage Stage, uint32 FrameNumber)
+{
+	// Start at the frame number's slot, frame numbers repeat while the splash is up or nothing is rendered
+	FPXRGameFramePtr* Ring = Rings[(int32)Stage];
+	for (int32 Probe = 0; Probe < RingSize; Probe++)
+	{
+		FPXRGameFramePtr& Slot = Ring[(FrameNumber + Probe) % RingSize];
+		if (Slot.IsValid() && Slot.IsUnique())
+		{
+			// The last holder may have dropped it on another thread
+			FPlatformMisc::MemoryBarrier();
+			return Slot;
+		}
+	}
+
+	// A stage is holding on to more frames than expected, keep going with an unpooled frame
+	const int32 Overflows = OverflowCount.Increment();
+	if (Overflows == 1 || Overflows % 1000 == 0)
+	{
+		PXR_LOGI(PxrUnreal, "GameFramePool stage %d has no free frame (frame %u), overflows:%d", (int32)Stage, FrameNumber, Overflows);
+	}
+	return MakeShareable(new FPXRGameFrame());
+}
+
+FPXRGameFramePtr FPXRGameFramePool::AcquireNew(uint32 FrameNumber)
+{
+	FPXRGameFramePtr Frame = AcquireSlot(EPXRGameFrameStage::GameThread, FrameNumber);
+	*Frame = FPXRGameFrame();
+	Frame->FrameNumber = FrameNumber;
+	Frame->FrameBeginTimeSeconds = Frame->StageBeginTimeSeconds = FPlatformTime::Seconds();
+	return Frame;
+}
+
+FPXRGameFramePtr FPXRGameFramePool::AcquireCopy(EPXRGameFrameStage Stage, const FPXRGameFrame& Source)
+{
+	FPXRGameFramePtr Frame = AcquireSlot(Stage, Source.FrameNumber);
+	*Frame = Source;
+	Frame->StageBeginTimeSeconds = FPlatformTime::Seconds();
+	return Frame;
+}
+
+void FPXRGameFramePool::Release(EPXRGameFrameStage Stage, const FPXRGameFrame& Frame)
+{
+	const int32 ReportInterval = CVarPICOGameFrameStageStats.GetValueOnAnyThread();
+	if (ReportInterval <= 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	FScopeLock ScopeLock(&StatsLock);
+	StageResidency[(int32)Stage].Add(Now - Frame.StageBeginTimeSeconds);
+	if (Stage != EPXRGameFrameStage::RHIThread)
+	{
+		return;
+	}
+
+	FrameResidency.Add(Now - Frame.FrameBeginTimeSeconds);
+	if (FrameResidency.NumFrames >= (uint32)ReportInterval)
+	{
+		static const TCHAR* StageNames[] = { TEXT("Game"), TEXT("Render"), TEXT("RHI") };
+		for (int32 StageIndex = 0; StageIndex < (int32)EPXRGameFrameStage::Num; StageIndex++)
+		{
+			const FResidency& Residency = StageResidency[StageIndex];
+			PXR_LOGI(PxrUnreal, "GameFrame %s stage: avg %.2fms, max %.2fms over %u frames", PLATFORM_CHAR(StageNames[StageIndex]),
+				Residency.NumFrames > 0 ? Residency.TotalSeconds * 1000.0 / Residency.NumFrames : 0.0, Residency.MaxSeconds * 1000.0, Residency.NumFrames);
+			StageResidency[StageIndex] = FResidency();
+		}
+		PXR_LOGI(PxrUnreal, "GameFrame begin to EndFrame: avg %.2fms, max %.2fms over %u frames, pool overflows:%d",
+			FrameResidency.TotalSeconds * 1000.0 / FrameResidency.NumFrames, FrameResidency.MaxSeconds * 1000.0, FrameResidency.NumFrames, OverflowCount.GetValue());
+		FrameResidency = FResidency();
+	}
+}
+
+void FPXRGameFramePool::Reset()
+{
+	for (int32 Stage = 0; Stage < (int32)EPXRGameFrameStage::Num; Stage++)
+	{
+		for (int32 Slot = 0; Slot < RingSize; Slot++)
+		{
+			// Frames still held by a stage stay alive through their own references
+			Rings[Stage][Slot] = MakeShareable(new FPXRGameFrame());
+		}
+	}
+}
@@ -20,6 +20,9 @@ public:
 	FVector Velocity;
 	FEngineShowFlags ShowFlags;
 	bool    bHasWaited;
+	// FPlatformTime::Seconds() when the frame was created / entered its current pipeline stage
+	double FrameBeginTimeSeconds;
+	double StageBeginTimeSeconds;
 	union
 	{
 		struct
@@ -34,4 +37,51 @@ public:
 	TSharedPtr<FPXRGameFrame, ESPMode::ThreadSafe> CloneMyself() const;
 };
 
-typedef TSharedPtr<FPXRGameFrame, ESPMode::ThreadSafe> FPXRGameFramePtr;
\ No newline at end of file
+typedef TSharedPtr<FPXRGameFrame, ESPMode::ThreadSafe> FPXRGameFramePtr;
+
+enum class EPXRGameFrameStage : uint8
+{
+	GameThread,
+	RenderThread,
+	RHIThread,
+	Num
+};
+
+/**
+ * Preallocated game frames, one ring per pipeline stage. Every stage works on its own copy of the frame,
+ * and a slot can be handed out again once the pool holds its only reference.
+ * Each ring must only be acquired from on a single thread (game thread: GameThread, RenderThread; render thread: RHIThread).
+ * With vr.PICO.GameFrameStageStats > 0 the time frames spend in each stage is logged every that many frames.
+ */
+class FPXRGameFramePool
+{
+public:
+	FPXRGameFramePool();
+
+	FPXRGameFramePtr AcquireNew(uint32 FrameNumber);
+	FPXRGameFramePtr AcquireCopy(EPXRGameFrameStage Stage, const FPXRGameFrame& Source);
+	// Ends the residency of Frame in Stage, only used for the stage report
+	void Release(EPXRGameFrameStage Stage, const FPXRGameFrame& Frame);
+	void Reset();
+
+private:
+	FPXRGameFramePtr AcquireSlot(EPXRGameFrameStage Stage, uint32 FrameNumber);
+
+	// Game, render and RHI copies of the frames in flight plus one of slack
+	static const int32 RingSize = 4;
+	FPXRGameFramePtr Rings[(int32)EPXRGameFrameStage::Num][RingSize];
+	FThreadSafeCounter OverflowCount;
+
+	struct FResidency
+	{
+		double TotalSeconds;
+		double MaxSeconds;
+		uint32 NumFrames;
+
+		FResidency() : TotalSeconds(0), MaxSeconds(0), NumFrames(0) {}
+		void Add(double Seconds);
+	};
+	FCriticalSection StatsLock;
+	FResidency StageResidency[(int32)EPXRGameFrameStage::Num];
+	FResidency FrameResidency;
+};
@@ -13,6 +13,8 @@
 #include "GameFramework/WorldSettings.h"
 #include "Misc/EngineVersion.h"
 #include "PXR_Utils.h"
+#include "PXR_MockRuntime.h"
+#include "PXR_BoundarySystem.h"
 
 #if PLATFORM_ANDROID
 #include "HardwareInfo.h"
@@ -167,6 +169,7 @@ void FPICOXRHMD::ResetOrientation(float Yaw /*= 0.f*/)
 {
 #if PLATFORM_ANDROID
  	Pxr_ResetSensor(PxrResetSensorOption::PXR_RESET_ORIENTATION);
+	UPICOXRBoundarySystem::InvalidateGeometryCache();
 #endif
 }
 
@@ -174,6 +177,7 @@ void FPICOXRHMD::ResetPosition()
 {
 #if PLATFORM_ANDROID
  	Pxr_ResetSensor(PxrResetSensorOption::PXR_RESET_POSITION);
+	UPICOXRBoundarySystem::InvalidateGeometryCache();
 #endif
 }
 
@@ -321,6 +325,8 @@ FQuat FPICOXRHMD::GetBaseOrientation() const
 void FPICOXRHMD::SetTrackingOrigin(EHMDTrackingOrigin::Type NewOrigin)
 {
 #if PLATFORM_ANDROID
+	// The boundary polygon is reported relative to the tracking origin
+	UPICOXRBoundarySystem::InvalidateGeometryCache();
     switch (NewOrigin)
     {
 	    case EHMDTrackingOrigin::Eye:
@@ -561,6 +567,8 @@ void FPICOXRHMD::GetEyeRenderParams_RenderThread(const struct FRenderingComposit
 FPICOXRHMD::FPICOXRHMD(const FAutoRegister&AutoRegister)
 	: FHeadMountedDisplayBase(nullptr)
 	, FSceneViewExtensionBase(AutoRegister)
+	, LayerMapVersion_GameThread(0)
+	, bLayerSnapshotDirty_RenderThread(true)
 	, NextLayerId(0)
 	, inputFocusState(true)
 	, DisplayRefreshRate(72.0f)
@@ -639,6 +647,22 @@ void FPICOXRHMD::BeginXR()
 	Pxr_SetControllerEnableKey(PICOXRSetting->bEnableHomeKey, PxrControllerKeyMap::PXR_CONTROLLER_KEY_HOME);
     uint32_t device;
 	Pxr_GetControllerMainInputHandle(&device);
+#elif PICOXR_MOCK_RUNTIME
+	ExecuteOnRenderThread([this]()
+	{
+		ExecuteOnRHIThread([this]()
+		{
+			FPXRMockRuntime& MockRuntime = FPXRMockRuntime::Get();
+			if (!MockRuntime.IsRunning())
+			{
+				MockRuntime.BeginXr();
+				float RefreshRate = 72.0f;
+				MockRuntime.GetDisplayRefreshRate(&RefreshRate);
+				DisplayRefreshRate = RefreshRate != 0 ? RefreshRate : 72.0f;
+				PXR_LOGI(PxrUnreal, "MockRuntime DisplayRefreshRate:%f", DisplayRefreshRate);
+			}
+		});
+	});
 #endif
 }
 
@@ -656,6 +680,14 @@ void FPICOXRHMD::EndXR()
 	        });
         });
 	}
+#elif PICOXR_MOCK_RUNTIME
+	ExecuteOnRenderThread([]()
+	{
+		ExecuteOnRHIThread([]()
+		{
+			FPXRMockRuntime::Get().EndXr();
+		});
+	});
 #endif
 }
 
@@ -675,10 +707,9 @@ FPICOXRInput* FPICOXRHMD::GetPICOXRInput()
 	return nullptr;
 }
 
-FPXRGameFramePtr FPICOXRHMD::MakeNewGameFrame() const
+FPXRGameFramePtr FPICOXRHMD::MakeNewGameFrame()
 {
-	FPXRGameFramePtr Result(MakeShareable(new FPXRGameFrame()));
-	Result->FrameNumber = NextGameFrameNumber;
+	FPXRGameFramePtr Result = GameFramePool.AcquireNew(NextGameFrameNumber);
 	Result->predictedDisplayTimeMs = CurrentFramePredictedTime + 1000.0f / DisplayRefreshRate;
 	Result->WorldToMetersScale = CachedWorldToMetersScale;
 	Result->Flags.bSplashIsShown = PICOSplash->IsShown();
@@ -919,6 +950,33 @@ bool FPICOXRHMD::Initialize()
 
 	RefreshStereoRenderingState();
  	return true;
+#elif PICOXR_MOCK_RUNTIME
+	// Headless frame pipeline: no RenderBridge and no swapchains, layers only exist inside the mock runtime
+	if (!FPXRMockRuntime::IsRequested())
+	{
+		return false;
+	}
+	PXR_LOGI(PxrUnreal, "Initialize with the mock runtime");
+	FPXRMockRuntime::Get().Initialize();
+	RHIString = TEXT("Mock");
+	IpdValue = 0.063f;
+	bWaitFrameVersion = true;
+
+	IStereoLayers::FLayerDesc EyeLayerDesc;
+	EyeLayerDesc.Priority = INT_MIN;
+	EyeLayerDesc.Flags = LAYER_FLAG_TEX_CONTINUOUS_UPDATE;
+	const uint32 EyeLayerId = CreateLayer(EyeLayerDesc);
+	check(EyeLayerId == 0);
+
+	PICOSplash = MakeShareable(new FPXRSplash(this));
+	PICOSplash->InitSplash();
+
+	ContentResourceFinder = NewObject<UPICOContentResourceFinder>();
+	ContentResourceFinder->AddToRoot();
+
+	RefreshStereoRenderingState();
+	BeginXR();
+	return true;
 #endif
  	return false;
 }
@@ -985,6 +1043,7 @@ void FPICOXRHMD::InitEyeLayer_RenderThread(FRHICommandListImmediate& RHICmdList)
 		DelayDeletion.AddLayerToDeferredDeletionQueue(PXREyeLayer_RenderThread);
 
 		PXREyeLayer_RenderThread = EyeLayer;
+		bLayerSnapshotDirty_RenderThread = true;
 	}
 }
 
@@ -1067,7 +1126,13 @@ void FPICOXRHMD::ProcessEvent(int32 EventCount, PxrEventDataBuffer** EventData)
 		case PXR_TYPE_EVENT_DATA_MRC_STATUS:
 		{
 			const PxrEventDataMrcStatusChanged MRC = *reinterpret_cast<const PxrEventDataMrcStatusChanged*>(Event);
-			MRCEnabled = MRC.mrc_status == 0 ? true : false;
+			const bool bMRCEnabled = MRC.mrc_status == 0;
+			if (MRCEnabled != bMRCEnabled)
+			{
+				PXR_LOGD(PxrUnreal, "ProcessEvent PXR_TYPE_EVENT_DATA_MRC_STATUS Enabled:%d", bMRCEnabled);
+				MRCEnabled = bMRCEnabled;
+				MRCStatusChangedDelegate.Broadcast(MRCEnabled);
+			}
 			break;
 		}
 		case PXR_TYPE_EVENT_DATA_REFRESH_RATE_CHANGED:
@@ -1082,6 +1147,8 @@ void FPICOXRHMD::ProcessEvent(int32 EventCount, PxrEventDataBuffer** EventData)
 		{
 			const PxrEventDataSessionStateChanged sessionStateChanged = *reinterpret_cast<const PxrEventDataSessionStateChanged*>(Event);
 			inputFocusState = sessionStateChanged.state == PXR_SESSION_STATE_FOCUSED;
+			// The boundary can only be redrawn or recentered while the app is out of focus
+			UPICOXRBoundarySystem::InvalidateGeometryCache();
 			break;
 		}
 		default:
@@ -1173,10 +1240,17 @@ void FPICOXRHMD::UnInitialize()
 {
 #if PLATFORM_ANDROID
 	Pxr_Shutdown();
+#elif PICOXR_MOCK_RUNTIME
+	FPXRMockRuntime::Get().Shutdown();
 #endif
 	PXRLayerMap.Reset();
 	PXRLayers_RenderThread.Reset();
-	PXRLayers_RHIThread.Reset();
+	PXRLayersScratch_RenderThread.Reset();
+	LayerSnapshot_GameThread.Reset();
+	LayerSnapshot_RenderThread.Reset();
+	LayerSnapshot_RHIThread.Reset();
+	LayerSnapshotPool_GameThread.Reset();
+	LayerSnapshotPool_RenderThread.Reset();
  	FCoreUObjectDelegates::PreLoadMap.RemoveAll(this);
 	if (PreLoadLevelDelegate.IsValid())
 	{
@@ -1203,6 +1277,7 @@ void FPICOXRHMD::ApplicationPauseDelegate()
 void FPICOXRHMD::ApplicationResumeDelegate()
 {
 	PXR_LOGI(PxrUnreal,"FPICOXRHMD::ApplicationResumeDelegate");
+	UPICOXRBoundarySystem::InvalidateGeometryCache();
 	if (EventManager)
 	{
 		EventManager->ResumeDelegate.Broadcast();
@@ -1250,9 +1325,8 @@ void FPICOXRHMD::UpdateNeckOffset()
 
 void FPICOXRHMD::UpdateSensorValue(FPXRGameFrame* InFrame)
 {
-#if PLATFORM_ANDROID
+#if PLATFORM_ANDROID || PICOXR_MOCK_RUNTIME
     //Position Orientation
-    FPICOXRInput* PICOInput = GetPICOXRInput();
     FVector SourcePosition = FVector::ZeroVector;
 	FVector LinearAcceleration = FVector::ZeroVector;
 	FVector AngularAcceleration = FVector::ZeroVector;
@@ -1260,6 +1334,7 @@ void FPICOXRHMD::UpdateSensorValue(FPXRGameFrame* InFrame)
 	FVector LinearVelocity = FVector::ZeroVector;
     FQuat SourceOrientation = FQuat::Identity;
     int32 ViewNumber = 0;
+#if PLATFORM_ANDROID
     int eyeCount = 1;
     PxrPosef pose;
     
@@ -1288,6 +1363,16 @@ void FPICOXRHMD::UpdateSensorValue(FPXRGameFrame* InFrame)
 	LinearVelocity.X = sensorState.linearVelocity.x;
 	LinearVelocity.Y = sensorState.linearVelocity.y;
 	LinearVelocity.Z = sensorState.linearVelocity.z;
+#else
+	FPXRMockSensorState SensorState;
+	FPXRMockRuntime::Get().GetPredictedMainSensorStateWithEyePose(InFrame->predictedDisplayTimeMs, &SensorState, &ViewNumber);
+	SourcePosition = SensorState.Position;
+	SourceOrientation = SensorState.Orientation;
+	LinearAcceleration = SensorState.LinearAcceleration;
+	AngularAcceleration = SensorState.AngularAcceleration;
+	AngularVelocity = SensorState.AngularVelocity;
+	LinearVelocity = SensorState.LinearVelocity;
+#endif
 
 	FVector Position = FPICOXRUtils::ConvertXRVectorToUnrealVector(SourcePosition, InFrame->WorldToMetersScale);
 
@@ -1578,6 +1663,7 @@ uint32 FPICOXRHMD::CreateLayer(const FLayerDesc& InLayerDesc)
     check(IsInGameThread());
     uint32 LayerId = NextLayerId++;
     PXRLayerMap.Add(LayerId, MakeShareable(new FPICOXRStereoLayer(this, LayerId, InLayerDesc)));
+    LayerMapVersion_GameThread++;
 	PXR_LOGD(PxrUnreal, "Layer Create LayerId=%d", LayerId);
     return LayerId;
 }
@@ -1586,7 +1672,10 @@ void FPICOXRHMD::DestroyLayer(uint32 LayerId)
 {
 	check(IsInGameThread());
     PXR_LOGD(PxrUnreal, "DestroyLayer LayerId=%d", LayerId);
-	PXRLayerMap.Remove(LayerId);
+	if (PXRLayerMap.Remove(LayerId) > 0)
+	{
+		LayerMapVersion_GameThread++;
+	}
 }
 
 void FPICOXRHMD::SetLayerDesc(uint32 LayerId, const FLayerDesc& InLayerDesc)
@@ -1598,6 +1687,7 @@ void FPICOXRHMD::SetLayerDesc(uint32 LayerId, const FLayerDesc& InLayerDesc)
 		FPICOXRStereoLayer* Layer = new FPICOXRStereoLayer(**LayerFound);
 		Layer->SetPXRLayerDesc(InLayerDesc);
 		*LayerFound = MakeShareable(Layer);
+		LayerMapVersion_GameThread++;
 	}
 }
 
@@ -1620,6 +1710,7 @@ void FPICOXRHMD::MarkTextureForUpdate(uint32 LayerId)
     if (LayerFound)
     {
         (*LayerFound)->MarkTextureForUpdate();
+        LayerMapVersion_GameThread++;
     }
 }
 
@@ -1810,6 +1901,7 @@ uint32 FPICOXRHMD::CreateMRCStereoLayer(FTextureRHIRef BackgroundRTTexture, FTex
 	CurrentMRCLayer= MakeShareable(new FPICOXRStereoLayer(this, LayerId, StereoLayerDesc));
 	PXRLayerMap.Add(LayerId, CurrentMRCLayer);
 	PXRLayerMap[LayerId]->bMRCLayer = true;
+	LayerMapVersion_GameThread++;
 	return LayerId;
 }
 
@@ -1850,6 +1942,9 @@ void FPICOXRHMD::WaitFrame()
 #if PLATFORM_ANDROID
 				Pxr_WaitFrame();
 				Pxr_GetPredictedDisplayTime(&CurrentFramePredictedTime);
+#elif PICOXR_MOCK_RUNTIME
+				FPXRMockRuntime::Get().WaitFrame();
+				FPXRMockRuntime::Get().GetPredictedDisplayTime(&CurrentFramePredictedTime);
 #endif
 				GameFrame_GameThread->bHasWaited = true;
 				GameFrame_GameThread->predictedDisplayTimeMs = CurrentFramePredictedTime;
@@ -1864,6 +1959,12 @@ void FPICOXRHMD::WaitFrame()
 		}
 		else
 		{
+			if (!PICOSplash->IsShown() && GameFrame_GameThread->FrameNumber == PICOSplash->GetHandoffFrameNumber())
+			{
+				// The splash waited this frame while handing off, see FPXRSplash::EndTicker
+				GameFrame_GameThread->bHasWaited = true;
+				GameFrame_GameThread->predictedDisplayTimeMs = CurrentFramePredictedTime;
+			}
 			PXR_LOGV(PxrUnreal, "WaitFrame not wait! %u,bSplashIsShowing:%d,WaitedFrameNumber:%u", GameFrame_GameThread->FrameNumber, PICOSplash->IsShown(), WaitedFrameNumber);
 		}
 	}
@@ -1895,8 +1996,13 @@ void FPICOXRHMD::LateUpdatePose()
  void FPICOXRHMD::OnGameFrameBegin_GameThread()
 {
 	 check(IsInGameThread());
+#if PLATFORM_ANDROID || PICOXR_MOCK_RUNTIME
 #if PLATFORM_ANDROID
-	 if (!GameFrame_GameThread.IsValid() && Pxr_IsRunning())
+	 const bool bRuntimeRunning = Pxr_IsRunning();
+#else
+	 const bool bRuntimeRunning = FPXRMockRuntime::Get().IsRunning();
+#endif
+	 if (!GameFrame_GameThread.IsValid() && bRuntimeRunning)
 	 {
 		 PICOSplash->SwitchActiveSplash_GameThread();
 		 GameFrame_GameThread = MakeNewGameFrame();
@@ -1934,85 +2040,165 @@ void FPICOXRHMD::LateUpdatePose()
 		 {
 			 NextGameFrameNumber++;
 		 }
-		 FPXRGameFramePtr PXRFrame = NextGameFrameToRender_GameThread->CloneMyself();
+		 FPXRGameFramePtr PXRFrame = GameFramePool.AcquireCopy(EPXRGameFrameStage::RenderThread, *NextGameFrameToRender_GameThread);
+		 GameFramePool.Release(EPXRGameFrameStage::GameThread, *NextGameFrameToRender_GameThread);
 		 PXR_LOGV(PxrUnreal, "OnRenderFrameBegin_GameThread %u has been eaten by render-thread!", NextGameFrameToRender_GameThread->FrameNumber);
-		 TArray<FPICOLayerPtr> PXRLayers;
+		 FPXRLayerSnapshotPtr PXRLayers = UpdateLayerSnapshot_GameThread();
 
-		 PXRLayers.Empty(PXRLayerMap.Num());
+		 ExecuteOnRenderThread_DoNotWait([this, PXRFrame, PXRLayers](FRHICommandListImmediate& RHICmdList)
+			 {
+				 if (PXRFrame.IsValid())
+				 {
+					 GameFrame_RenderThread = PXRFrame;
+					 MergeLayerSnapshot_RenderThread(*PXRLayers, RHICmdList);
+					 DelayDeletion.HandleLayerDeferredDeletionQueue_RenderThread();
+				 }
+			 });
+	 }
+ }
+
+ FPXRLayerSnapshotPtr FPICOXRHMD::UpdateLayerSnapshot_GameThread()
+ {
+	 check(IsInGameThread());
+
+	 if (!LayerSnapshot_GameThread.IsValid() || LayerSnapshot_GameThread->Version != LayerMapVersion_GameThread)
+	 {
+		 FPXRLayerSnapshotPtr Snapshot = LayerSnapshotPool_GameThread.Acquire();
+		 Snapshot->Version = LayerMapVersion_GameThread;
+		 Snapshot->Entries.Reserve(PXRLayerMap.Num());
+
+		 for (const TPair<uint32, FPICOLayerPtr>& Pair : PXRLayerMap)
+		 {
+			 FPXRLayerSnapshotEntry Entry;
+			 Entry.ID = Pair.Value->GetID();
+			 Entry.DescVersion = Pair.Value->GetDescVersion();
+			 Entry.bTextureNeedUpdate = Pair.Value->IsTextureNeedUpdate();
+
+			 // Only layers whose descriptor changed are copied, the others keep the copy the render thread already owns
+			 const FPXRLayerSnapshotEntry* LastEntry = LayerSnapshot_GameThread.IsValid() ? LayerSnapshot_GameThread->FindEntry(Entry.ID) : nullptr;
+			 Entry.Layer = (LastEntry && LastEntry->DescVersion == Entry.DescVersion) ? LastEntry->Layer : Pair.Value->CloneMyself();
+			 Snapshot->AddSorted(Entry);
+		 }
+		 LayerSnapshot_GameThread = Snapshot;
+	 }
 
-		 for (auto Pair : PXRLayerMap)
+	 for (const TPair<uint32, FPICOLayerPtr>& Pair : PXRLayerMap)
+	 {
+		 const IStereoLayers::FLayerDesc& LayerDesc = Pair.Value->GetPXRLayerDesc();
+		 const bool bTextureNeedUpdate = (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE) && LayerDesc.Texture.IsValid();
+		 if (Pair.Value->IsTextureNeedUpdate() != bTextureNeedUpdate)
 		 {
-			 PXRLayers.Emplace(Pair.Value->CloneMyself());
+			 Pair.Value->MarkTextureForUpdate(bTextureNeedUpdate);
+			 LayerMapVersion_GameThread++;
+		 }
+	 }
+
+	 return LayerSnapshot_GameThread;
+ }
+
+ void FPICOXRHMD::MergeLayerSnapshot_RenderThread(const FPXRLayerSnapshot& Snapshot, FRHICommandListImmediate& RHICmdList)
+ {
+	 check(IsInRenderingThread());
+
+	 const TArray<FPXRLayerSnapshotEntry>& PXRLayers = Snapshot.Entries;
+	 int32 PXRLayerIndex_Current = 0;
+	 int32 PXRLastLayerIndex_RenderThread = 0;
+	 TArray<FPICOLayerPtr>& ValidXLayers = PXRLayersScratch_RenderThread;
+	 ValidXLayers.Reset();
+
+	 while (PXRLayerIndex_Current < PXRLayers.Num() && PXRLastLayerIndex_RenderThread < PXRLayers_RenderThread.Num())
+	 {
+		 const FPXRLayerSnapshotEntry& Entry = PXRLayers[PXRLayerIndex_Current];
+		 const FPICOLayerPtr& RenderLayer = PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread];
+		 uint32 LayerIdX = Entry.ID;
+		 uint32 LayerIdY = RenderLayer->GetID();
 
-			 if (Pair.Value->GetPXRLayerDesc().Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE && Pair.Value->GetPXRLayerDesc().Texture.IsValid())
+		 if (LayerIdX < LayerIdY)
+		 {
+			 Entry.Layer->MarkTextureForUpdate(Entry.bTextureNeedUpdate);
+			 if (Entry.Layer->InitPXRLayer_RenderThread(RenderBridge, &DelayDeletion, RHICmdList))
 			 {
-				 Pair.Value->MarkTextureForUpdate(true);
+				 ValidXLayers.Add(Entry.Layer);
 			 }
-			 else
+			 PXRLayerIndex_Current++;
+		 }
+		 else if (LayerIdX > LayerIdY)
+		 {
+			 DelayDeletion.AddLayerToDeferredDeletionQueue(PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread++]);
+		 }
+		 else if (Entry.DescVersion == RenderLayer->GetDescVersion())
+		 {
+			 // Unchanged since the last frame, the render thread layer stays as it is
+			 if (Entry.bTextureNeedUpdate)
 			 {
-				 Pair.Value->MarkTextureForUpdate(false);
+				 RenderLayer->MarkTextureForUpdate(true);
 			 }
+			 ValidXLayers.Add(RenderLayer);
+			 PXRLastLayerIndex_RenderThread++;
+			 PXRLayerIndex_Current++;
 		 }
-		 PXRLayers.Sort(FPICOLayerPtr_SortById());
-
-		 ExecuteOnRenderThread_DoNotWait([this,PXRFrame, PXRLayers](FRHICommandListImmediate& RHICmdList)
+		 else
+		 {
+			 Entry.Layer->MarkTextureForUpdate(Entry.bTextureNeedUpdate);
+			 if (Entry.Layer->InitPXRLayer_RenderThread(RenderBridge, &DelayDeletion, RHICmdList, RenderLayer.Get()))
 			 {
-				 if (PXRFrame.IsValid())
-				 {
-					 GameFrame_RenderThread = PXRFrame;
-
-					 int32 PXRLayerIndex_Current = 0;
-					 int32 PXRLastLayerIndex_RenderThread = 0;
-					 TArray<FPICOLayerPtr> ValidXLayers;
-
-					 while (PXRLayerIndex_Current < PXRLayers.Num() && PXRLastLayerIndex_RenderThread < PXRLayers_RenderThread.Num())
-					 {
-						 uint32 LayerIdX = PXRLayers[PXRLayerIndex_Current]->GetID();
-						 uint32 LayerIdY = PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread]->GetID();
+				 PXRLastLayerIndex_RenderThread++;
+				 ValidXLayers.Add(Entry.Layer);
+			 }
+			 PXRLayerIndex_Current++;
+		 }
+	 }
 
-						 if (LayerIdX < LayerIdY)
-						 {
-							 if (PXRLayers[PXRLayerIndex_Current]->InitPXRLayer_RenderThread(RenderBridge, &DelayDeletion, RHICmdList))
-							 {
-								 ValidXLayers.Add(PXRLayers[PXRLayerIndex_Current]);
-							 }
-							 PXRLayerIndex_Current++;
-						 }
-						 else if (LayerIdX > LayerIdY)
-						 {
-							 DelayDeletion.AddLayerToDeferredDeletionQueue(PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread++]);
-						 }
-						 else
-						 {
-							 if (PXRLayers[PXRLayerIndex_Current]->InitPXRLayer_RenderThread(RenderBridge, &DelayDeletion, RHICmdList, PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread].Get()))
-							 {
-								 PXRLastLayerIndex_RenderThread++;
-								 ValidXLayers.Add(PXRLayers[PXRLayerIndex_Current]);
-							 }
-							 PXRLayerIndex_Current++;
-						 }
-					 }
+	 while (PXRLayerIndex_Current < PXRLayers.Num())
+	 {
+		 const FPXRLayerSnapshotEntry& Entry = PXRLayers[PXRLayerIndex_Current];
+		 Entry.Layer->MarkTextureForUpdate(Entry.bTextureNeedUpdate);
+		 if (Entry.Layer->InitPXRLayer_RenderThread(RenderBridge, &DelayDeletion, RHICmdList))
+		 {
+			 ValidXLayers.Add(Entry.Layer);
+		 }
+		 PXRLayerIndex_Current++;
+	 }
 
-					 while (PXRLayerIndex_Current < PXRLayers.Num())
-					 {
-						 if (PXRLayers[PXRLayerIndex_Current]->InitPXRLayer_RenderThread(RenderBridge, &DelayDeletion, RHICmdList))
-						 {
-							 ValidXLayers.Add(PXRLayers[PXRLayerIndex_Current]);
-						 }
-						 PXRLayerIndex_Current++;
-					 }
+	 while (PXRLastLayerIndex_RenderThread < PXRLayers_RenderThread.Num())
+	 {
+		 DelayDeletion.AddLayerToDeferredDeletionQueue(PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread++]);
+	 }
 
-					 while (PXRLastLayerIndex_RenderThread < PXRLayers_RenderThread.Num())
-					 {
-						 DelayDeletion.AddLayerToDeferredDeletionQueue(PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread++]);
-					 }
+	 if (ValidXLayers != PXRLayers_RenderThread)
+	 {
+		 bLayerSnapshotDirty_RenderThread = true;
+	 }
+	 Swap(PXRLayers_RenderThread, PXRLayersScratch_RenderThread);
+	 PXRLayersScratch_RenderThread.Reset();
+ }
 
-					 PXRLayers_RenderThread = ValidXLayers;
+ FPXRLayerSnapshotPtr FPICOXRHMD::GetLayerSnapshot_RenderThread()
+ {
+	 check(IsInRenderingThread());
 
-					 DelayDeletion.HandleLayerDeferredDeletionQueue_RenderThread();
-				 }
+	 if (bLayerSnapshotDirty_RenderThread || !LayerSnapshot_RenderThread.IsValid())
+	 {
+		 FPXRLayerSnapshotPtr Snapshot = LayerSnapshotPool_RenderThread.Acquire();
+		 Snapshot->Entries.Reserve(PXRLayers_RenderThread.Num());
+		 for (const FPICOLayerPtr& Layer : PXRLayers_RenderThread)
+		 {
+			 FPXRLayerSnapshotEntry Entry;
+			 Entry.ID = Layer->GetID();
+			 Entry.DescVersion = Layer->GetDescVersion();
+			 Entry.bTextureNeedUpdate = false;
+			 Entry.Layer = Layer;
+			 Snapshot->Entries.Add(Entry);
+		 }
+		 // Submit order only changes together with the layer set, so it is sorted here instead of every RHI frame
+		 Snapshot->Entries.Sort([](const FPXRLayerSnapshotEntry& A, const FPXRLayerSnapshotEntry& B)
+			 {
+				 return FLayerPtr_CompareByAll()(A.Layer, B.Layer);
 			 });
+		 LayerSnapshot_RenderThread = Snapshot;
+		 bLayerSnapshotDirty_RenderThread = false;
 	 }
+	 return LayerSnapshot_RenderThread;
  }
 
  void FPICOXRHMD::OnRenderFrameEnd_RenderThread(FRHICommandListImmediate& RHICmdList)
@@ -2036,19 +2222,16 @@ void FPICOXRHMD::LateUpdatePose()
 	 check(IsInRenderingThread());
 	 if (GameFrame_RenderThread.IsValid())
 	 {
-		 FPXRGameFramePtr PXRFrame = GameFrame_RenderThread->CloneMyself();
-		 TArray<FPICOLayerPtr> PXRLayers = PXRLayers_RenderThread;
+		 FPXRGameFramePtr PXRFrame = GameFramePool.AcquireCopy(EPXRGameFrameStage::RHIThread, *GameFrame_RenderThread);
+		 GameFramePool.Release(EPXRGameFrameStage::RenderThread, *GameFrame_RenderThread);
+		 FPXRLayerSnapshotPtr PXRLayers = GetLayerSnapshot_RenderThread();
 
-		 for (int32 XLayerIndex = 0; XLayerIndex < PXRLayers.Num(); XLayerIndex++)
-		 {
-			 PXRLayers[XLayerIndex] = PXRLayers[XLayerIndex]->CloneMyself();
-		 }
 		 ExecuteOnRHIThread_DoNotWait([this, PXRFrame, PXRLayers]()
 			 {
 				 if (PXRFrame.IsValid())
 				 {
 					 GameFrame_RHIThread = PXRFrame;
-					 PXRLayers_RHIThread = PXRLayers;
+					 LayerSnapshot_RHIThread = PXRLayers;
 					 PXR_LOGV(PxrUnreal, "BeginFrame %u", GameFrame_RHIThread->FrameNumber);
 					 if (GameFrame_RHIThread->ShowFlags.Rendering && !GameFrame_RHIThread->Flags.bSplashIsShown) 
 					 {
@@ -2061,15 +2244,29 @@ void FPICOXRHMD::LateUpdatePose()
 								 Pxr_GetPredictedDisplayTime(&CurrentFramePredictedTime);
 								 PXR_LOGV(PxrUnreal, "Pxr_GetPredictedDisplayTime after Pxr_BeginFrame:%f", CurrentFramePredictedTime);
 							 }
-							 for (int32 LayerIndex = 0; LayerIndex < PXRLayers_RHIThread.Num(); LayerIndex++)
+							 for (const FPXRLayerSnapshotEntry& Entry : LayerSnapshot_RHIThread->Entries)
 							 {
-								 PXRLayers_RHIThread[LayerIndex]->IncrementSwapChainIndex_RHIThread(RenderBridge);
+								 Entry.Layer->IncrementSwapChainIndex_RHIThread(RenderBridge);
 							 }
 						 }
 						 else
 						 {
 							 PXR_LOGE(PxrUnreal, "Pxr Is Not Running!!!");
 						 }
+#elif PICOXR_MOCK_RUNTIME
+						 FPXRMockRuntime& MockRuntime = FPXRMockRuntime::Get();
+						 if (MockRuntime.IsRunning())
+						 {
+							 MockRuntime.BeginFrame();
+							 if (!bWaitFrameVersion)
+							 {
+								 MockRuntime.GetPredictedDisplayTime(&CurrentFramePredictedTime);
+							 }
+							 for (const FPXRLayerSnapshotEntry& Entry : LayerSnapshot_RHIThread->Entries)
+							 {
+								 Entry.Layer->IncrementSwapChainIndex_RHIThread(RenderBridge);
+							 }
+						 }
 #endif
 					 }
 				 }
@@ -2086,16 +2283,16 @@ void FPICOXRHMD::LateUpdatePose()
 			 PLATFORM_CHAR(*(GameFrame_RHIThread->Orientation.Rotator().ToString())), PLATFORM_CHAR(*(GameFrame_RHIThread->Position.ToString())));
 		 if (GameFrame_RHIThread->ShowFlags.Rendering && !GameFrame_RHIThread->Flags.bSplashIsShown)
 		 {
-			 TArray<FPICOLayerPtr> Layers = PXRLayers_RHIThread;
-			 Layers.Sort(FLayerPtr_CompareByAll());
+			 // Already in submit order, see GetLayerSnapshot_RenderThread
+			 const TArray<FPXRLayerSnapshotEntry>& Layers = LayerSnapshot_RHIThread->Entries;
 #if PLATFORM_ANDROID
 			 if (Pxr_IsRunning())
 			 {
 				 for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); LayerIndex++)
 				 {
-					 if (Layers[LayerIndex]->IsVisible())
+					 if (Layers[LayerIndex].Layer->IsVisible())
 					 {
-						 Layers[LayerIndex]->SubmitLayer_RHIThread(GameFrame_RHIThread.Get());
+						 Layers[LayerIndex].Layer->SubmitLayer_RHIThread(GameFrame_RHIThread.Get());
 					 }
 				 }
 				 Pxr_EndFrame();
@@ -2104,8 +2301,22 @@ void FPICOXRHMD::LateUpdatePose()
 			 {
 				 PXR_LOGE(PxrUnreal, "Pxr Is Not Running!!!");
 			 }
+#elif PICOXR_MOCK_RUNTIME
+			 FPXRMockRuntime& MockRuntime = FPXRMockRuntime::Get();
+			 if (MockRuntime.IsRunning())
+			 {
+				 for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); LayerIndex++)
+				 {
+					 if (Layers[LayerIndex].Layer->IsVisible())
+					 {
+						 Layers[LayerIndex].Layer->SubmitLayer_RHIThread(GameFrame_RHIThread.Get());
+					 }
+				 }
+				 MockRuntime.EndFrame();
+			 }
 #endif
 		 }
+		 GameFramePool.Release(EPXRGameFrameStage::RHIThread, *GameFrame_RHIThread);
 	 }
 	 GameFrame_RHIThread.Reset();
  }
@@ -15,6 +15,7 @@
 #include "Engine/Public/SceneUtils.h"
 #include "PXR_GameFrame.h"
 #include "PXR_DelayDeleteLayer.h"
+#include "PXR_LayerSnapshot.h"
 #if PLATFORM_ANDROID
 #include "Android/AndroidApplication.h"
 #include "Android/AndroidJNI.h"
@@ -255,8 +256,9 @@ public:
 	void OnRenderFrameEnd_RenderThread(FRHICommandListImmediate& RHICmdList);
 	void OnRHIFrameBegin_RenderThread();
 	void OnRHIFrameEnd_RHIThread();
-	FPXRGameFramePtr MakeNewGameFrame() const;
+	FPXRGameFramePtr MakeNewGameFrame();
 	void RefreshStereoRenderingState();
+	FPXRGameFramePool GameFramePool;
 	// Game thread
 	uint32 NextGameFrameNumber;
 	uint32 WaitedFrameNumber;
@@ -265,13 +267,22 @@ public:
 	FPXRGameFramePtr LastGameFrameToRender_GameThread;
 	TMap<uint32, FPICOLayerPtr> PXRLayerMap;
 	FPICOLayerPtr CurrentMRCLayer;
+	// Bumped whenever PXRLayerMap or a layer in it changes, an unchanged map resends the last snapshot
+	uint32 LayerMapVersion_GameThread;
+	FPXRLayerSnapshotPtr LayerSnapshot_GameThread;
+	FPXRLayerSnapshotPool LayerSnapshotPool_GameThread;
 	// Render thread
 	FPXRGameFramePtr GameFrame_RenderThread;
 	TArray<FPICOLayerPtr> PXRLayers_RenderThread;
+	TArray<FPICOLayerPtr> PXRLayersScratch_RenderThread;
 	FPICOLayerPtr PXREyeLayer_RenderThread;
+	// Layers in submit order, rebuilt only when PXRLayers_RenderThread changes
+	FPXRLayerSnapshotPtr LayerSnapshot_RenderThread;
+	FPXRLayerSnapshotPool LayerSnapshotPool_RenderThread;
+	bool bLayerSnapshotDirty_RenderThread;
 	// RHI thread
 	FPXRGameFramePtr GameFrame_RHIThread;
-	TArray<FPICOLayerPtr> PXRLayers_RHIThread;
+	FPXRLayerSnapshotPtr LayerSnapshot_RHIThread;
 	double CurrentFramePredictedTime = 0;
 	bool bWaitFrameVersion = false;
 	float CachedWorldToMetersScale = 100.0f;
@@ -280,6 +291,9 @@ public:
 	UPICOXREventManager* EventManager;
 	uint32 NextLayerId;
 	bool MRCEnabled=false;
+	/** Broadcast on the game thread when the runtime turns MRC on or off */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnMRCStatusChanged, bool /*bEnabled*/);
+	FOnMRCStatusChanged MRCStatusChangedDelegate;
 	FLinearColor GColorScale = FLinearColor(1.0,1.0,1.0,1.0);
 	FLinearColor GColorOffset = FLinearColor(0.0,0.0,0.0,0.0);
     bool GbApplyToAllLayers = false;
@@ -297,6 +311,9 @@ public:
 	double DisplayRefreshRate;
 protected:
 	void InitEyeLayer_RenderThread(FRHICommandListImmediate& RHICmdList);
+	FPXRLayerSnapshotPtr UpdateLayerSnapshot_GameThread();
+	void MergeLayerSnapshot_RenderThread(const FPXRLayerSnapshot& Snapshot, FRHICommandListImmediate& RHICmdList);
+	FPXRLayerSnapshotPtr GetLayerSnapshot_RenderThread();
 
 private:
 #if PLATFORM_ANDROID
@@ -178,6 +178,15 @@ bool UPICOXRHMDFunctionLibrary::GetFocusState()
     return false;
 }
 
+void UPICOXRHMDFunctionLibrary::PXR_PreloadSplashTexture(TSoftObjectPtr<UTexture> SplashTexture)
+{
+    FPICOXRHMD* PICOXRHMDInstance = GetPICOXRHMD();
+    if (PICOXRHMDInstance != nullptr && PICOXRHMDInstance->GetSplash())
+    {
+        PICOXRHMDInstance->GetSplash()->PreloadSplashTexture(SplashTexture.ToSoftObjectPath());
+    }
+}
+
 UPICOXRBoundarySystem* UPICOXRHMDFunctionLibrary::GetBoundarySystemInterface()
 {
     return UPICOXRBoundarySystem::GetInstance();
@@ -403,6 +412,47 @@ bool UPICOXRHMDFunctionLibrary::PXR_GetFaceTrackingData(int64 InTimeStamp, int64
     return false;
 }
 
+bool UPICOXRHMDFunctionLibrary::PXR_GetFaceTrackingDataAtTime(double TimeSeconds, int64& OutTimeStamp, TArray<float>& BlendShapeWeight, float &LaughingProb, TArray<float>& EmotionProb)
+{
+#if PLATFORM_ANDROID
+	FPICOXRHMD* HMD = GetPICOXRHMD();
+	if (HMD && GetMutableDefault<UPICOXRSettings>()->FaceTrackingMode != EPICOXRFaceTrackingMode::Disable)
+	{
+		const TSharedPtr<FPICOXREyeTracker> FaceOrEyeTracker = HMD->UPxr_GetEyeTracker();
+		FPXRFaceTrackingSample Sample;
+		if (FaceOrEyeTracker && FaceOrEyeTracker->GetFaceTrackingHistory().Sample(TimeSeconds, Sample))
+		{
+			OutTimeStamp = Sample.RuntimeTimestamp;
+			LaughingProb = Sample.LaughingProb;
+			BlendShapeWeight.SetNumUninitialized(FPXRFaceTrackingSample::NumBlendShapes, false);
+			EmotionProb.SetNumUninitialized(FPXRFaceTrackingSample::NumEmotions, false);
+			FMemory::Memcpy(BlendShapeWeight.GetData(), Sample.BlendShapeWeight, sizeof(Sample.BlendShapeWeight));
+			FMemory::Memcpy(EmotionProb.GetData(), Sample.EmotionProb, sizeof(Sample.EmotionProb));
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+bool UPICOXRHMDFunctionLibrary::PXR_GetEyeTrackingDataAtTime(double TimeSeconds, FPICOXREyeTrackingData& EyeTrackingData)
+{
+#if PLATFORM_ANDROID
+	FPICOXRHMD* HMD = GetPICOXRHMD();
+	if (HMD && GetMutableDefault<UPICOXRSettings>()->bEnableEyeTracking)
+	{
+		const TSharedPtr<FPICOXREyeTracker> FaceOrEyeTracker = HMD->UPxr_GetEyeTracker();
+		FPXREyeTrackingSample Sample;
+		if (FaceOrEyeTracker && FaceOrEyeTracker->GetEyeTrackingHistory().Sample(TimeSeconds, Sample))
+		{
+			EyeTrackingData = Sample.Data;
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
 bool UPICOXRHMDFunctionLibrary::PXR_EnableEyeTracking(bool enable)
 {
 #if PLATFORM_ANDROID
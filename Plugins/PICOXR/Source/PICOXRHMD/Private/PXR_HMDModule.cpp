@@ -3,6 +3,7 @@
 #include "PXR_HMDModule.h"
 #include "PXR_HMD.h"
 #include "PXR_Settings.h"
+#include "PXR_SystemAPIWorker.h"
 #include "HardwareInfo.h"
 
 #if PLATFORM_ANDROID
@@ -63,6 +64,7 @@ void FPICOXRHMDModule::ShutdownModule()
 {
 	IHeadMountedDisplayModule::ShutdownModule();
 	UnregisterSettings();
+	FPXRSystemAPIWorker::Shutdown();
 }
 
 FString FPICOXRHMDModule::GetModuleKeyName() const
@@ -0,0 +1,67 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "PXR_LayerSnapshot.h"
+#include "Algo/BinarySearch.h"
+#include "PXR_Log.h"
+
+// Snapshots in flight are one per stage (game, render, RHI) plus a frame of slack; more means a consumer leaks references
+static const int32 PXR_LAYER_SNAPSHOT_POOL_WARN_SIZE = 8;
+
+const FPXRLayerSnapshotEntry* FPXRLayerSnapshot::FindEntry(uint32 LayerId) const
+{
+	const int32 Index = Algo::BinarySearchBy(Entries, LayerId, [](const FPXRLayerSnapshotEntry& Entry) { return Entry.ID; });
+	return Index != INDEX_NONE ? &Entries[Index] : nullptr;
+}
+
+void FPXRLayerSnapshot::AddSorted(const FPXRLayerSnapshotEntry& Entry)
+{
+	// Layer IDs only grow, so this is an append unless the source container reordered them
+	if (Entries.Num() == 0 || Entries.Last().ID < Entry.ID)
+	{
+		Entries.Add(Entry);
+	}
+	else
+	{
+		const int32 Index = Algo::LowerBoundBy(Entries, Entry.ID, [](const FPXRLayerSnapshotEntry& InEntry) { return InEntry.ID; });
+		Entries.Insert(Entry, Index);
+	}
+}
+
+void FPXRLayerSnapshot::Reset()
+{
+	Version = 0;
+	Entries.Reset();
+}
+
+FPXRLayerSnapshotPtr FPXRLayerSnapshotPool::Acquire()
+{
+	FPXRLayerSnapshotPtr Result;
+	for (const FPXRLayerSnapshotPtr& Snapshot : Snapshots)
+	{
+		if (Snapshot.IsUnique())
+		{
+			// Idle snapshots must not keep released layers (and their swapchains) alive
+			Snapshot->Reset();
+			if (!Result.IsValid())
+			{
+				Result = Snapshot;
+			}
+		}
+	}
+
+	if (!Result.IsValid())
+	{
+		Result = MakeShareable(new FPXRLayerSnapshot());
+		Snapshots.Add(Result);
+		if (Snapshots.Num() > PXR_LAYER_SNAPSHOT_POOL_WARN_SIZE)
+		{
+			PXR_LOGI(PxrUnreal, "Layer snapshot pool grew to %d", Snapshots.Num());
+		}
+	}
+	return Result;
+}
+
+void FPXRLayerSnapshotPool::Reset()
+{
+	Snapshots.Reset();
+}
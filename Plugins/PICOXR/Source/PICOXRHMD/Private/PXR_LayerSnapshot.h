@@ -0,0 +1,50 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "PXR_StereoLayer.h"
+
+struct FPXRLayerSnapshotEntry
+{
+	uint32 ID;
+	uint32 DescVersion;
+	bool bTextureNeedUpdate;
+	FPICOLayerPtr Layer;
+};
+
+/**
+ * Set of stereo layers handed from one thread to the next (game -> render -> RHI).
+ * Game thread snapshots are sorted by layer ID, render thread ones are in submit order.
+ * A snapshot is never modified once it has been handed over; the producer only refills it
+ * after every consumer has dropped its reference.
+ */
+class FPXRLayerSnapshot
+{
+public:
+	FPXRLayerSnapshot() : Version(0) {}
+
+	// Both expect the entries sorted by layer ID
+	const FPXRLayerSnapshotEntry* FindEntry(uint32 LayerId) const;
+	void AddSorted(const FPXRLayerSnapshotEntry& Entry);
+	void Reset();
+
+	uint32 Version;
+	TArray<FPXRLayerSnapshotEntry> Entries;
+};
+
+typedef TSharedPtr<FPXRLayerSnapshot, ESPMode::ThreadSafe> FPXRLayerSnapshotPtr;
+
+/**
+ * Recycles snapshots owned by a single producer thread, so steady-state frames do not touch the heap.
+ * A pooled snapshot is reusable as soon as the pool holds its only reference.
+ */
+class FPXRLayerSnapshotPool
+{
+public:
+	FPXRLayerSnapshotPtr Acquire();
+	void Reset();
+	int32 Num() const { return Snapshots.Num(); }
+
+private:
+	TArray<FPXRLayerSnapshotPtr> Snapshots;
+};
@@ -0,0 +1,287 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "PXR_MockRuntime.h"
+
+#if PICOXR_MOCK_RUNTIME
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "PXR_Log.h"
+
+// Mirrors PxrReturnStatus, PxrApi.h is not available off device
+static const int PXR_MOCK_RET_SUCCESS = 0;
+static const int PXR_MOCK_RET_ERROR = -1;
+
+FPXRMockRuntime& FPXRMockRuntime::Get()
+{
+	static FPXRMockRuntime Instance;
+	return Instance;
+}
+
+bool FPXRMockRuntime::IsRequested()
+{
+	static const bool bRequested = FParse::Param(FCommandLine::Get(), TEXT("pxrmock"));
+	return bRequested;
+}
+
+FPXRMockRuntime::FPXRMockRuntime()
+	: bInitialized(false)
+	, bRunning(false)
+	, bInFrame(false)
+	, DisplayTimeMs(0)
+	, LastWaitRealTimeSeconds(0)
+	, SensorFrameIndex(0)
+{
+	float RefreshRate = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("pxrmockrefreshrate="), RefreshRate) && RefreshRate > 0.0f)
+	{
+		Config.DisplayRefreshRate = RefreshRate;
+	}
+	FParse::Value(FCommandLine::Get(), TEXT("pxrmocklatency="), Config.SensorLatencyMs);
+	FParse::Value(FCommandLine::Get(), TEXT("pxrmockmaxlayers="), Config.MaxLayerCount);
+	Config.bSleepToVsync = FParse::Param(FCommandLine::Get(), TEXT("pxrmockvsync"));
+}
+
+void FPXRMockRuntime::Configure(const FPXRMockRuntimeConfig& InConfig)
+{
+	FScopeLock ScopeLock(&Lock);
+	Config = InConfig;
+	PXR_LOGI(PxrUnreal, "MockRuntime Configure RefreshRate:%f,SensorLatencyMs:%f,MaxLayerCount:%d,bSleepToVsync:%d",
+		Config.DisplayRefreshRate, Config.SensorLatencyMs, Config.MaxLayerCount, Config.bSleepToVsync);
+}
+
+FPXRMockRuntimeConfig FPXRMockRuntime::GetConfig() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Config;
+}
+
+FPXRMockRuntimeStats FPXRMockRuntime::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Stats;
+}
+
+void FPXRMockRuntime::ResetStats()
+{
+	FScopeLock ScopeLock(&Lock);
+	const int32 LiveLayers = Stats.LiveLayers;
+	Stats = FPXRMockRuntimeStats();
+	Stats.LiveLayers = Stats.PeakLiveLayers = LiveLayers;
+}
+
+bool FPXRMockRuntime::IsInitialized() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return bInitialized;
+}
+
+int FPXRMockRuntime::Initialize()
+{
+	FScopeLock ScopeLock(&Lock);
+	bInitialized = true;
+	DisplayTimeMs = 0;
+	SensorFrameIndex = 0;
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::Shutdown()
+{
+	FScopeLock ScopeLock(&Lock);
+	bInitialized = false;
+	bRunning = false;
+	bInFrame = false;
+	Layers.Reset();
+	Stats.LiveLayers = 0;
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+bool FPXRMockRuntime::IsRunning() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return bRunning;
+}
+
+int FPXRMockRuntime::BeginXr()
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bInitialized)
+	{
+		return PXR_MOCK_RET_ERROR;
+	}
+	bRunning = true;
+	LastWaitRealTimeSeconds = FPlatformTime::Seconds();
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::EndXr()
+{
+	FScopeLock ScopeLock(&Lock);
+	bRunning = false;
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::GetDisplayRefreshRate(float* OutRefreshRate) const
+{
+	FScopeLock ScopeLock(&Lock);
+	*OutRefreshRate = Config.DisplayRefreshRate;
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::WaitFrame()
+{
+	double SleepSeconds = 0;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!bRunning)
+		{
+			return PXR_MOCK_RET_ERROR;
+		}
+		const double FramePeriodMs = GetFramePeriodMs();
+		DisplayTimeMs += FramePeriodMs;
+		Stats.FramesWaited++;
+
+		if (Config.bSleepToVsync)
+		{
+			const double NextVsyncSeconds = LastWaitRealTimeSeconds + FramePeriodMs / 1000.0;
+			const double NowSeconds = FPlatformTime::Seconds();
+			SleepSeconds = NextVsyncSeconds - NowSeconds;
+			// Missed vsyncs are not caught up, just like the compositor drops them
+			LastWaitRealTimeSeconds = SleepSeconds > 0 ? NextVsyncSeconds : NowSeconds;
+		}
+	}
+
+	if (SleepSeconds > 0)
+	{
+		FPlatformProcess::Sleep(SleepSeconds);
+	}
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::GetPredictedDisplayTime(double* OutPredictedDisplayTimeMs) const
+{
+	FScopeLock ScopeLock(&Lock);
+	*OutPredictedDisplayTimeMs = DisplayTimeMs + GetFramePeriodMs();
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+void FPXRMockRuntime::EvaluatePose(double TimeMs, FPXRMockSensorState& OutSensorState) const
+{
+	// A slow head sweep: yaw oscillates +-30 degrees every 4 seconds with a little vertical bob,
+	// all closed-form in time so every run produces the same poses.
+	const double Seconds = TimeMs / 1000.0;
+	const double YawFrequency = 2.0 * PI / 4.0;
+	const double BobFrequency = 2.0 * PI / 1.5;
+	const float Yaw = FMath::DegreesToRadians(30.0f) * FMath::Sin(YawFrequency * Seconds);
+	const float YawRate = FMath::DegreesToRadians(30.0f) * YawFrequency * FMath::Cos(YawFrequency * Seconds);
+	const float YawAcceleration = -FMath::DegreesToRadians(30.0f) * YawFrequency * YawFrequency * FMath::Sin(YawFrequency * Seconds);
+
+	// Runtime space is y-up, right handed, so yaw is a rotation around +Y
+	OutSensorState.Orientation = FQuat(FVector(0, 1, 0), Yaw);
+	OutSensorState.Position = FVector(0, 0.02f * FMath::Sin(BobFrequency * Seconds), 0);
+	OutSensorState.AngularVelocity = FVector(0, YawRate, 0);
+	OutSensorState.AngularAcceleration = FVector(0, YawAcceleration, 0);
+	OutSensorState.LinearVelocity = FVector(0, 0.02f * BobFrequency * FMath::Cos(BobFrequency * Seconds), 0);
+	OutSensorState.LinearAcceleration = FVector(0, -0.02f * BobFrequency * BobFrequency * FMath::Sin(BobFrequency * Seconds), 0);
+	OutSensorState.PoseTimeStampNs = (uint64)(FMath::Max(TimeMs, 0.0) * 1000000.0);
+}
+
+int FPXRMockRuntime::GetPredictedMainSensorStateWithEyePose(double PredictTimeMs, FPXRMockSensorState* OutSensorState, int* OutSensorFrameIndex)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bRunning)
+	{
+		return PXR_MOCK_RET_ERROR;
+	}
+	// The pose is sampled SensorLatencyMs before the requested time, i.e. the prediction is late by that much
+	EvaluatePose(PredictTimeMs - Config.SensorLatencyMs, *OutSensorState);
+	*OutSensorFrameIndex = ++SensorFrameIndex;
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::BeginFrame()
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bRunning)
+	{
+		return PXR_MOCK_RET_ERROR;
+	}
+	if (bInFrame)
+	{
+		Stats.UnbalancedFrames++;
+	}
+	bInFrame = true;
+	Stats.FramesBegun++;
+	for (TPair<int32, int32>& Layer : Layers)
+	{
+		Layer.Value = (Layer.Value + 1) % FMath::Max(Config.SwapChainLength, 1u);
+	}
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::EndFrame()
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bInFrame)
+	{
+		Stats.UnbalancedFrames++;
+		return PXR_MOCK_RET_ERROR;
+	}
+	bInFrame = false;
+	Stats.FramesEnded++;
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::CreateLayer(int LayerId)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bInitialized || Layers.Contains(LayerId) || Layers.Num() >= Config.MaxLayerCount)
+	{
+		Stats.LayerCreateFailures++;
+		return PXR_MOCK_RET_ERROR;
+	}
+	Layers.Add(LayerId, 0);
+	Stats.LayersCreated++;
+	Stats.LiveLayers = Layers.Num();
+	Stats.PeakLiveLayers = FMath::Max(Stats.PeakLiveLayers, Stats.LiveLayers);
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::GetLayerNextImageIndex(int LayerId, int* OutImageIndex) const
+{
+	FScopeLock ScopeLock(&Lock);
+	const int32* ImageIndex = Layers.Find(LayerId);
+	if (!ImageIndex)
+	{
+		return PXR_MOCK_RET_ERROR;
+	}
+	*OutImageIndex = *ImageIndex;
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::SubmitLayer(int LayerId)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bInFrame || !Layers.Contains(LayerId))
+	{
+		return PXR_MOCK_RET_ERROR;
+	}
+	Stats.LayersSubmitted++;
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+int FPXRMockRuntime::DestroyLayer(int LayerId)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (Layers.Remove(LayerId) == 0)
+	{
+		return PXR_MOCK_RET_ERROR;
+	}
+	Stats.LayersDestroyed++;
+	Stats.LiveLayers = Layers.Num();
+	return PXR_MOCK_RET_SUCCESS;
+}
+
+#endif
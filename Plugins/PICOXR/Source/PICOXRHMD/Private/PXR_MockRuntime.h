@@ -0,0 +1,118 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#if PICOXR_MOCK_RUNTIME
+
+/**
+ * Timing and limits of the in-process stand-in runtime.
+ * The defaults match a 72Hz headset with a couple of milliseconds of sensor latency.
+ */
+struct FPXRMockRuntimeConfig
+{
+	float DisplayRefreshRate;
+	double SensorLatencyMs;
+	int32 MaxLayerCount;
+	uint32 SwapChainLength;
+	// false: the display clock advances one vsync per WaitFrame without blocking, so runs are repeatable.
+	// true: WaitFrame really sleeps until the next vsync, like the device compositor does.
+	bool bSleepToVsync;
+
+	FPXRMockRuntimeConfig()
+		: DisplayRefreshRate(72.0f)
+		, SensorLatencyMs(2.0)
+		, MaxLayerCount(16)
+		, SwapChainLength(3)
+		, bSleepToVsync(false)
+	{
+	}
+};
+
+/** Raw (runtime-space) sensor sample, laid out like PxrSensorState */
+struct FPXRMockSensorState
+{
+	FVector Position;
+	FQuat Orientation;
+	FVector AngularVelocity;
+	FVector LinearVelocity;
+	FVector AngularAcceleration;
+	FVector LinearAcceleration;
+	uint64 PoseTimeStampNs;
+};
+
+struct FPXRMockRuntimeStats
+{
+	uint64 FramesWaited;
+	uint64 FramesBegun;
+	uint64 FramesEnded;
+	uint64 LayersSubmitted;
+	uint64 LayersCreated;
+	uint64 LayersDestroyed;
+	uint64 LayerCreateFailures;
+	uint64 UnbalancedFrames;
+	int32 LiveLayers;
+	int32 PeakLiveLayers;
+
+	FPXRMockRuntimeStats()
+	{
+		FMemory::Memzero(*this);
+	}
+};
+
+/**
+ * Deterministic stand-in for libpxr_api used on platforms without the PICO runtime (Linux).
+ * Every entry point mirrors the Pxr_* call it replaces and returns 0 on success like the runtime does.
+ * Calls may come from the game, render and RHI threads, so all state is guarded by one lock.
+ * Only active when the process is started with -pxrmock.
+ */
+class FPXRMockRuntime
+{
+public:
+	static FPXRMockRuntime& Get();
+	static bool IsRequested();
+
+	void Configure(const FPXRMockRuntimeConfig& InConfig);
+	FPXRMockRuntimeConfig GetConfig() const;
+	FPXRMockRuntimeStats GetStats() const;
+	void ResetStats();
+
+	bool IsInitialized() const;
+	int Initialize();
+	int Shutdown();
+	bool IsRunning() const;
+	int BeginXr();
+	int EndXr();
+	int GetDisplayRefreshRate(float* OutRefreshRate) const;
+
+	int WaitFrame();
+	int GetPredictedDisplayTime(double* OutPredictedDisplayTimeMs) const;
+	int GetPredictedMainSensorStateWithEyePose(double PredictTimeMs, FPXRMockSensorState* OutSensorState, int* OutSensorFrameIndex);
+	int BeginFrame();
+	int EndFrame();
+
+	int CreateLayer(int LayerId);
+	int GetLayerNextImageIndex(int LayerId, int* OutImageIndex) const;
+	int SubmitLayer(int LayerId);
+	int DestroyLayer(int LayerId);
+
+private:
+	FPXRMockRuntime();
+
+	double GetFramePeriodMs() const { return 1000.0 / FMath::Max(Config.DisplayRefreshRate, 1.0f); }
+	void EvaluatePose(double TimeMs, FPXRMockSensorState& OutSensorState) const;
+
+	mutable FCriticalSection Lock;
+	FPXRMockRuntimeConfig Config;
+	FPXRMockRuntimeStats Stats;
+	bool bInitialized;
+	bool bRunning;
+	bool bInFrame;
+	double DisplayTimeMs;
+	double LastWaitRealTimeSeconds;
+	int32 SensorFrameIndex;
+	// LayerId -> current swapchain image
+	TMap<int32, int32> Layers;
+};
+
+#endif
@@ -4,3 +4,4 @@
 #include "PXR_Shaders.h"
 
 IMPLEMENT_SHADER_TYPE(, FPICOCubemapPS, TEXT("/Plugin/PICOXR/Private/PICOShaders.usf"), TEXT("MainForCubemap"), SF_Pixel);
+IMPLEMENT_SHADER_TYPE(, FPICOMRCSplitPS, TEXT("/Plugin/PICOXR/Private/PICOShaders.usf"), TEXT("MainMRCSplit"), SF_Pixel);
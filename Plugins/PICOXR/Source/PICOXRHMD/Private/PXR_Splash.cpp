@@ -6,6 +6,34 @@
 #include "Kismet/StereoLayerFunctionLibrary.h"
 #include "Runtime/HeadMountedDisplay/Public/XRThreadUtils.h"
 #include "PXR_Log.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/Texture2D.h"
+#include "Engine/Engine.h"
+
+static TAutoConsoleVariable<int32> CVarPICOSplashTextureBudgetMB(
+	TEXT("vr.PICO.Splash.TextureBudgetMB"),
+	32,
+	TEXT("Memory splash textures stay resident in between splashes, in MB. Least recently used textures are released first, textures on screen never."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPICOSplashFrameRateDivisor(
+	TEXT("vr.PICO.Splash.FrameRateDivisor"),
+	2,
+	TEXT("The splash submits a frame every this many display frames, leaving the time in between to level loading. 1 submits every display frame."),
+	ECVF_Default);
+
+DECLARE_STATS_GROUP(TEXT("PICOXRSplash"), STATGROUP_PICOXRSplash, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Time To First Splash Frame (ms)"), STAT_PICOXRSplashTimeToFirstFrame, STATGROUP_PICOXRSplash);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Show Hitch (ms)"), STAT_PICOXRSplashShowHitch, STATGROUP_PICOXRSplash);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Resident Textures"), STAT_PICOXRSplashResidentTextures, STATGROUP_PICOXRSplash);
+DECLARE_MEMORY_STAT(TEXT("Resident Texture Memory"), STAT_PICOXRSplashResidentMemory, STATGROUP_PICOXRSplash);
+
+/** Splash layers copy their texture once, so a streamed texture is only used once every mip is resident */
+static bool IsSplashTextureStreamedIn(UTexture* Texture)
+{
+	UTexture2D* Texture2D = Cast<UTexture2D>(Texture);
+	return !Texture2D || Texture2D->IsFullyStreamedIn();
+}
 
 FPXRSplash::FPXRSplash(FPICOXRHMD* InPICOXRHMD)
 	: SplashTicker(nullptr)
@@ -17,6 +45,9 @@ FPXRSplash::FPXRSplash(FPICOXRHMD* InPICOXRHMD)
 	, bIsShown(false)
 	, bSplashNeedUpdateActiveState(false)
 	, bSplashShouldToShow(false)
+	, ShowStartCycles(0)
+	, bFirstSplashFrameReported(true)
+	, HandoffFrameNumber(0)
 	, FramesOutstanding(0)
 {
 	AddedPXRSplashLayers.Reset();
@@ -121,9 +152,19 @@ void FPXRSplash::ShutDownSplash()
 						PXRLayers_RenderThread_Entry.Reset();
 						PXRLayers_RenderThread.Reset();
 						PXRLayers_RHIThread.Reset();
+						PendingSplashLayers.Reset();
 					});
 			});
 
+		for (TPair<FSoftObjectPath, FSplashTextureEntry>& Pair : SplashTextureCache)
+		{
+			if (Pair.Value.Handle.IsValid())
+			{
+				Pair.Value.Handle->ReleaseHandle();
+			}
+		}
+		SplashTextureCache.Reset();
+
 		if (PostLoadLevelDelegate.IsValid())
 		{
 			FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadLevelDelegate);
@@ -146,9 +187,9 @@ void FPXRSplash::SplashTick_RenderThread(float DeltaTime)
 	}
 #endif
 
-	if (FramesOutstanding > 0)
+	if (!SplashPacer.ShouldStartFrame(FPlatformTime::Seconds(), FramesOutstanding))
 	{
-		PXR_LOGV(PxrUnreal, "Splash skipping frame; too many frames outstanding");
+		PXR_LOGV(PxrUnreal, "Splash skipping frame; not due yet or frames outstanding:%d", FramesOutstanding);
 		return;
 	}
 
@@ -218,6 +259,10 @@ void FPXRSplash::BeginTicker()
 
 void FPXRSplash::EndTicker()
 {
+	// Hands the frame loop over to the main loop at HandoffFrameNumber. Once the ticker is stopped the RHI thread is
+	// flushed, so the last splash frame has been begun and ended before anyone waits on the next one. The splash then
+	// waits the hand-off frame itself, the main loop finds it already waited, takes its predicted display time and
+	// begins it without waiting a second time
 	ExecuteOnRenderThread([this]()
 		{
 			if (SplashTicker.IsValid())
@@ -226,44 +271,46 @@ void FPXRSplash::EndTicker()
 				SplashTicker = nullptr;
 				PXR_LOGI(PxrUnreal, "Splash StopTicker!");
 			}
+			ExecuteOnRHIThread([]() {});
+			check(FramesOutstanding == 0);
+
+			HandoffFrameNumber = PICOXRHMD->NextGameFrameNumber;
+#if PLATFORM_ANDROID
+			if (Pxr_IsRunning() && PICOXRHMD->WaitedFrameNumber < HandoffFrameNumber)
+			{
+				PXR_LOGV(PxrUnreal, "Splash WaitFrame %u for the main loop", HandoffFrameNumber);
+				if (PICOXRHMD->bWaitFrameVersion)
+				{
+					Pxr_WaitFrame();
+					Pxr_GetPredictedDisplayTime(&(PICOXRHMD->CurrentFramePredictedTime));
+				}
+				PICOXRHMD->WaitedFrameNumber = HandoffFrameNumber;
+			}
+#endif
 		});
 }
 
 void FPXRSplash::ToShow()
 {
 	check(IsInGameThread());
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 	ReleaseAllTextures();
 
+	// Nothing is loaded or flushed here, this runs right before the hitch the splash is meant to cover. Textures still
+	// streaming in get a layer ID now and are swapped in by the render thread once their RHI resource exists
+	TArray<FPendingSplashLayer> NewPendingLayers;
 	for (int32 i = 0; i < AddedPXRSplashLayers.Num(); ++i)
 	{
 		FPXRSplashLayer& SplashLayer = AddedPXRSplashLayers[i];
 		if (SplashLayer.Desc.SplashTexturePath.IsValid())
 		{
-			LoadTexture(SplashLayer);
+			PreloadSplashTexture(SplashLayer.Desc.SplashTexturePath);
+			const FSplashTextureEntry* Entry = SplashTextureCache.Find(SplashLayer.Desc.SplashTexturePath);
+			SplashLayer.Desc.LoadingTextureFromPath = Entry ? Entry->Texture : nullptr;
+			UTexture* Texture = SplashLayer.Desc.LoadingTextureFromPath;
+			NewPendingLayers.Add({ PICOXRHMD->NextLayerId++, SplashLayer.Desc, Texture, Texture && IsSplashTextureStreamedIn(Texture) });
 		}
-		if (SplashLayer.Desc.LoadingTextureFromPath && SplashLayer.Desc.LoadingTextureFromPath->IsValidLowLevel())
-		{
-			SplashLayer.Desc.LoadingTextureFromPath->UpdateResource();
-		}
-	}
-	FlushRenderingCommands();
-
-	for (int32 i = 0; i < AddedPXRSplashLayers.Num(); ++i)
-	{
-		FPXRSplashLayer& SplashLayer = AddedPXRSplashLayers[i];
-		if (SplashLayer.Desc.LoadingTextureFromPath->IsValidLowLevel())
-		{
-			if (SplashLayer.Desc.LoadingTextureFromPath->Resource && SplashLayer.Desc.LoadingTextureFromPath->Resource->TextureRHI)
-			{
-				SplashLayer.Desc.LoadedTextureRef = SplashLayer.Desc.LoadingTextureFromPath->Resource->TextureRHI;
-			}
-			else
-			{
-				PXR_LOGI(PxrUnreal, "Splash %s - no Resource!", PLATFORM_CHAR(*SplashLayer.Desc.LoadingTextureFromPath->GetDesc()));
-			}
-		}
-
-		if (SplashLayer.Desc.LoadedTextureRef)
+		else if (SplashLayer.Desc.LoadedTextureRef)
 		{
 			const int32 PXRLayerID = PICOXRHMD->NextLayerId++;
 			SplashLayer.Layer = MakeShareable(new FPICOXRStereoLayer(PICOXRHMD, PXRLayerID, CreateStereoLayerDescFromPXRSplashDesc(SplashLayer.Desc)));
@@ -271,6 +318,7 @@ void FPXRSplash::ToShow()
 		}
 	}
 
+	bool bHasSplashLayers = false;
 	{
 		FScopeLock ScopeLock(&RenderThreadLock);
 		PXRLayers_RenderThread_Entry.Reset();
@@ -284,15 +332,25 @@ void FPXRSplash::ToShow()
 				PXRLayers_RenderThread_Entry.Add(ClonedLayer);
 			}
 		}
-		if (PXRLayers_RenderThread_Entry.Num() > 0)
+		PendingSplashLayers = MoveTemp(NewPendingLayers);
+		bHasSplashLayers = PXRLayers_RenderThread_Entry.Num() > 0 || PendingSplashLayers.Num() > 0;
+		if (bHasSplashLayers)
 		{
 			PXRLayers_RenderThread_Entry.Add(BlackLayer->CloneMyself());
 		}
 		PXRLayers_RenderThread_Entry.Sort(FPICOLayerPtr_SortById());
+		ShowStartCycles = StartCycles;
+		bFirstSplashFrameReported = false;
 	}
 
-	if (PXRLayers_RenderThread_Entry.Num() > 0)
+	if (bHasSplashLayers)
 	{
+		const double DisplayRefreshRate = PICOXRHMD->DisplayRefreshRate;
+		const int32 FrameRateDivisor = CVarPICOSplashFrameRateDivisor.GetValueOnGameThread();
+		ExecuteOnRenderThread_DoNotWait([this, DisplayRefreshRate, FrameRateDivisor](FRHICommandListImmediate& RHICmdList)
+			{
+				SplashPacer.Reset(DisplayRefreshRate, FrameRateDivisor);
+			});
 		BeginTicker();
 		bIsShown = true;
 	}
@@ -300,6 +358,7 @@ void FPXRSplash::ToShow()
 	{
 		PXR_LOGI(PxrUnreal, "No splash layers show!");
 	}
+	SET_FLOAT_STAT(STAT_PICOXRSplashShowHitch, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
 }
 
 void FPXRSplash::ToHide()
@@ -309,6 +368,24 @@ void FPXRSplash::ToHide()
 	bIsShown = false;
 	EndTicker();
 	ReleaseAllTextures();
+
+	FPXRSplashPacer::FIntervalHistogram Histogram;
+	SplashPacer.GetIntervalHistogram(Histogram);
+	PXR_LOGI(PxrUnreal, "Splash handed off to the main loop at frame %u after splash frame %u, %d frame intervals, longest %.1f ms",
+		HandoffFrameNumber, SplashPacer.GetLastFrameNumber(), Histogram.NumFrames, Histogram.MaxIntervalMs);
+}
+
+void FPXRSplash::DumpFrameIntervals(FOutputDevice& Ar) const
+{
+	FPXRSplashPacer::FIntervalHistogram Histogram;
+	SplashPacer.GetIntervalHistogram(Histogram);
+	Ar.Logf(TEXT("PICOXR splash frame intervals (%s): %d intervals, longest %.1f ms, handoff at frame %u"),
+		bIsShown ? TEXT("shown") : TEXT("last splash"), Histogram.NumFrames, Histogram.MaxIntervalMs, HandoffFrameNumber);
+	Ar.Logf(TEXT("%-16s %10s"), TEXT("Display frames"), TEXT("Count"));
+	for (int32 Bucket = 0; Bucket < FPXRSplashPacer::NumIntervalBuckets; Bucket++)
+	{
+		Ar.Logf(TEXT("%-16s %10d"), FPXRSplashPacer::GetIntervalBucketName(Bucket), Histogram.Counts[Bucket]);
+	}
 }
 
 void FPXRSplash::AutoShow(bool AutoShowSplash)
@@ -321,12 +398,160 @@ void FPXRSplash::AddPXRSplashLayers(const FPXRSplashDesc& Desc)
 {
 	check(IsInGameThread());
 	PXR_LOGI(PxrUnreal, "Splash AddSplash!");
+	{
+		FScopeLock ScopeLock(&RenderThreadLock);
+		AddedPXRSplashLayers.Add(FPXRSplashLayer(Desc));
+	}
+	if (Desc.SplashTexturePath.IsValid())
+	{
+		PreloadSplashTexture(Desc.SplashTexturePath);
+	}
+}
+
+void FPXRSplash::PreloadSplashTexture(const FSoftObjectPath& TexturePath)
+{
+	check(IsInGameThread());
+	if (!TexturePath.IsValid())
+	{
+		return;
+	}
+	FSplashTextureEntry& Entry = SplashTextureCache.FindOrAdd(TexturePath);
+	Entry.LastUsedSeconds = FPlatformTime::Seconds();
+	if (Entry.Handle.IsValid())
+	{
+		return;
+	}
+	PXR_LOGI(PxrUnreal, "Splash preload %s", PLATFORM_CHAR(*TexturePath.ToString()));
+	// The load can complete inside this call and trim the cache, so the entry is looked up again
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(TexturePath,
+		FStreamableDelegate::CreateSP(this, &FPXRSplash::OnSplashTextureLoaded, TexturePath), FStreamableManager::AsyncLoadHighPriority);
+	if (FSplashTextureEntry* LoadingEntry = SplashTextureCache.Find(TexturePath))
+	{
+		LoadingEntry->Handle = Handle;
+	}
+	else if (Handle.IsValid())
+	{
+		Handle->ReleaseHandle();
+	}
+}
+
+void FPXRSplash::OnSplashTextureLoaded(FSoftObjectPath TexturePath)
+{
+	check(IsInGameThread());
+	FSplashTextureEntry* Entry = SplashTextureCache.Find(TexturePath);
+	UTexture* Texture = Cast<UTexture>(TexturePath.ResolveObject());
+	if (!Entry)
+	{
+		return;
+	}
+	if (!Texture)
+	{
+		PXR_LOGI(PxrUnreal, "Splash %s failed to load!", PLATFORM_CHAR(*TexturePath.ToString()));
+		return;
+	}
+
+	// Splash layers copy their texture once, keep every mip resident rather than showing a low mip. The layer waits
+	// for the remaining mips in UpdatePendingLayerTextures_GameThread
+	if (UTexture2D* Texture2D = Cast<UTexture2D>(Texture))
+	{
+		Texture2D->bForceMiplevelsToBeResident = true;
+	}
+	Entry->Texture = Texture;
+	Entry->ResidentBytes = Texture->CalcTextureMemorySizeEnum(TMC_AllMips);
+
+	{
+		const bool bStreamedIn = IsSplashTextureStreamedIn(Texture);
+		FScopeLock ScopeLock(&RenderThreadLock);
+		for (FPendingSplashLayer& PendingLayer : PendingSplashLayers)
+		{
+			if (PendingLayer.Desc.SplashTexturePath == TexturePath)
+			{
+				PendingLayer.Texture = Texture;
+				PendingLayer.bTextureStreamedIn = bStreamedIn;
+			}
+		}
+	}
+	TrimTextureCache();
+}
+
+void FPXRSplash::UpdatePendingLayerTextures_GameThread()
+{
+	check(IsInGameThread());
 	FScopeLock ScopeLock(&RenderThreadLock);
-	AddedPXRSplashLayers.Add(FPXRSplashLayer(Desc));
+	for (FPendingSplashLayer& PendingLayer : PendingSplashLayers)
+	{
+		if (PendingLayer.Texture && !PendingLayer.bTextureStreamedIn)
+		{
+			PendingLayer.bTextureStreamedIn = IsSplashTextureStreamedIn(PendingLayer.Texture);
+		}
+	}
+}
+
+void FPXRSplash::TrimTextureCache()
+{
+	check(IsInGameThread());
+	auto IsOnScreen = [this](const FSoftObjectPath& TexturePath)
+	{
+		FScopeLock ScopeLock(&RenderThreadLock);
+		for (const FPendingSplashLayer& PendingLayer : PendingSplashLayers)
+		{
+			if (PendingLayer.Desc.SplashTexturePath == TexturePath)
+			{
+				return true;
+			}
+		}
+		if (bIsShown)
+		{
+			for (const FPXRSplashLayer& SplashLayer : AddedPXRSplashLayers)
+			{
+				if (SplashLayer.Desc.SplashTexturePath == TexturePath)
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	};
+
+	const int64 BudgetBytes = (int64)FMath::Max(CVarPICOSplashTextureBudgetMB.GetValueOnGameThread(), 0) * 1024 * 1024;
+	int64 ResidentBytes = 0;
+	for (const TPair<FSoftObjectPath, FSplashTextureEntry>& Pair : SplashTextureCache)
+	{
+		ResidentBytes += Pair.Value.ResidentBytes;
+	}
+	while (ResidentBytes > BudgetBytes)
+	{
+		const FSoftObjectPath* EvictPath = nullptr;
+		double OldestUse = MAX_dbl;
+		for (const TPair<FSoftObjectPath, FSplashTextureEntry>& Pair : SplashTextureCache)
+		{
+			if (Pair.Value.ResidentBytes > 0 && Pair.Value.LastUsedSeconds < OldestUse && !IsOnScreen(Pair.Key))
+			{
+				EvictPath = &Pair.Key;
+				OldestUse = Pair.Value.LastUsedSeconds;
+			}
+		}
+		if (!EvictPath)
+		{
+			break;
+		}
+		const FSoftObjectPath Path = *EvictPath;
+		FSplashTextureEntry Entry;
+		SplashTextureCache.RemoveAndCopyValue(Path, Entry);
+		PXR_LOGI(PxrUnreal, "Splash release %s, over the texture budget", PLATFORM_CHAR(*Path.ToString()));
+		ResidentBytes -= Entry.ResidentBytes;
+		if (Entry.Handle.IsValid())
+		{
+			Entry.Handle->ReleaseHandle();
+		}
+	}
+	SET_DWORD_STAT(STAT_PICOXRSplashResidentTextures, SplashTextureCache.Num());
+	SET_MEMORY_STAT(STAT_PICOXRSplashResidentMemory, ResidentBytes);
 }
 
 void FPXRSplash::SwitchActiveSplash_GameThread()
 {
+	UpdatePendingLayerTextures_GameThread();
 	if (bSplashNeedUpdateActiveState)
 	{
 		if (bSplashShouldToShow)
@@ -350,6 +575,7 @@ void FPXRSplash::SwitchActiveSplash_GameThread()
 void FPXRSplash::ReleaseAllTextures()
 {
 	FScopeLock ScopeLock(&RenderThreadLock);
+	PendingSplashLayers.Reset();
 	for (int32 i = 0; i < AddedPXRSplashLayers.Num(); ++i)
 	{
 		if (AddedPXRSplashLayers[i].Desc.SplashTexturePath.IsValid())
@@ -367,13 +593,27 @@ void FPXRSplash::ReleaseTexture(FPXRSplashLayer& InSplashLayer)
 	InSplashLayer.Layer.Reset();
 }
 
-void FPXRSplash::LoadTexture(FPXRSplashLayer& InSplashLayer)
+void FPXRSplash::AddReadyPendingLayers_RenderThread()
 {
-	check(IsInGameThread());
-	ReleaseTexture(InSplashLayer);
-	InSplashLayer.Desc.LoadingTextureFromPath = Cast<UTexture>(InSplashLayer.Desc.SplashTexturePath.TryLoad());
-	InSplashLayer.Desc.LoadedTextureRef = nullptr;
-	InSplashLayer.Layer.Reset();
+	check(IsInRenderingThread());
+	bool bLayersAdded = false;
+	for (int32 Index = PendingSplashLayers.Num() - 1; Index >= 0; Index--)
+	{
+		FPendingSplashLayer& PendingLayer = PendingSplashLayers[Index];
+		if (PendingLayer.bTextureStreamedIn && PendingLayer.Texture->Resource && PendingLayer.Texture->Resource->TextureRHI)
+		{
+			PendingLayer.Desc.LoadedTextureRef = PendingLayer.Texture->Resource->TextureRHI;
+			FPICOLayerPtr Layer = MakeShareable(new FPICOXRStereoLayer(PICOXRHMD, PendingLayer.LayerId, CreateStereoLayerDescFromPXRSplashDesc(PendingLayer.Desc)));
+			Layer->bSplashLayer = true;
+			PXRLayers_RenderThread_Entry.Add(Layer);
+			PendingSplashLayers.RemoveAtSwap(Index);
+			bLayersAdded = true;
+		}
+	}
+	if (bLayersAdded)
+	{
+		PXRLayers_RenderThread_Entry.Sort(FPICOLayerPtr_SortById());
+	}
 }
 
 void FPXRSplash::RenderSplashFrame_RenderThread(FRHICommandListImmediate& RHICmdList)
@@ -384,7 +624,9 @@ void FPXRSplash::RenderSplashFrame_RenderThread(FRHICommandListImmediate& RHICmd
 	SplashFrame->FrameNumber = PICOXRHMD->NextGameFrameNumber;
 	SplashFrame->predictedDisplayTimeMs = PICOXRHMD->CurrentFramePredictedTime + 1000.0f / PICOXRHMD->DisplayRefreshRate;
 	SplashFrame->ShowFlags.Rendering = true;
+	AddReadyPendingLayers_RenderThread();
 	TArray<FPICOLayerPtr> SplashEntryLayers = PXRLayers_RenderThread_Entry;
+	double PredictedDisplayTimeMs = 0.0;
 #if PLATFORM_ANDROID
 	if (Pxr_IsRunning() && PICOXRHMD->WaitedFrameNumber < SplashFrame->FrameNumber)
 	{
@@ -393,6 +635,7 @@ void FPXRSplash::RenderSplashFrame_RenderThread(FRHICommandListImmediate& RHICmd
 		{
 			Pxr_WaitFrame();
 			Pxr_GetPredictedDisplayTime(&(PICOXRHMD->CurrentFramePredictedTime));
+			PredictedDisplayTimeMs = PICOXRHMD->CurrentFramePredictedTime;
 			PXR_LOGV(PxrUnreal, "Splash Pxr_GetPredictedDisplayTime after Pxr_WaitFrame:%f", PICOXRHMD->CurrentFramePredictedTime);
 		}
 		PICOXRHMD->WaitedFrameNumber = SplashFrame->FrameNumber;
@@ -408,6 +651,15 @@ void FPXRSplash::RenderSplashFrame_RenderThread(FRHICommandListImmediate& RHICmd
 	if (SplashFrame->ShowFlags.Rendering)
 	{
 		PICOXRHMD->UpdateSensorValue(SplashFrame.Get());
+		SplashPacer.OnFrameStarted(FPlatformTime::Seconds(), SplashFrame->FrameNumber, PredictedDisplayTimeMs);
+
+		if (!bFirstSplashFrameReported && SplashEntryLayers.ContainsByPredicate([](const FPICOLayerPtr& Layer) { return !Layer->bSplashBlackProjectionLayer; }))
+		{
+			const double TimeToFirstFrameMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ShowStartCycles);
+			SET_FLOAT_STAT(STAT_PICOXRSplashTimeToFirstFrame, TimeToFirstFrameMs);
+			PXR_LOGI(PxrUnreal, "Splash first textured frame %.2f ms after show", TimeToFirstFrameMs);
+			bFirstSplashFrameReported = true;
+		}
 	}
 
 	{
@@ -454,7 +706,10 @@ void FPXRSplash::RenderSplashFrame_RenderThread(FRHICommandListImmediate& RHICmd
 		}
 	}
 
-	CustomRenderBridge->SubmitGPUCommands_RenderThread(RHICmdList);
+	if (CustomRenderBridge)
+	{
+		CustomRenderBridge->SubmitGPUCommands_RenderThread(RHICmdList);
+	}
 
 	for (int32 i = 0; i < SplashEntryLayers.Num(); i++)
 	{
@@ -543,3 +798,22 @@ IStereoLayers::FLayerDesc FPXRSplash::CreateStereoLayerDescFromPXRSplashDesc(FPX
 		(PXRSplashDesc.bIsLiveUpdate ? IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE : 0);
 	return LayerDesc;
 }
+
+static void DumpSplashFrameIntervals(const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+{
+	if (GEngine && GEngine->XRSystem.IsValid() && GEngine->XRSystem->GetSystemName() == FName(TEXT("PICOXRHMD")))
+	{
+		const FPICOXRSplashPtr Splash = static_cast<FPICOXRHMD*>(GEngine->XRSystem.Get())->GetSplash();
+		if (Splash.IsValid())
+		{
+			Splash->DumpFrameIntervals(Ar);
+			return;
+		}
+	}
+	Ar.Logf(TEXT("PICOXR splash is not running"));
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpSplashFrameIntervalsCommand(
+	TEXT("vr.PICO.Splash.FrameIntervals"),
+	TEXT("Prints a histogram of the gaps between the frames the current or last splash submitted, in display frames."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&DumpSplashFrameIntervals));
@@ -7,6 +7,8 @@
 #include "PXR_HMDTypes.h"
 #include "PXR_Settings.h"
 #include "PXR_GameFrame.h"
+#include "Engine/StreamableManager.h"
+#include "PXR_SplashPacer.h"
 
 struct FPXRSplashLayer
 {
@@ -53,6 +55,11 @@ public:
 	void AutoShow(bool AutoShowSplash);
 	void AddPXRSplashLayers(const FPXRSplashDesc& Splash);
 	void SwitchActiveSplash_GameThread();
+	/** Starts streaming a splash texture in so a later splash shows it without loading on the game thread */
+	void PreloadSplashTexture(const FSoftObjectPath& TexturePath);
+	/** Frame the splash waited and handed to the main frame loop when it was last hidden, the main loop begins it without waiting again */
+	uint32 GetHandoffFrameNumber() const { return HandoffFrameNumber; }
+	void DumpFrameIntervals(FOutputDevice& Ar) const;
 	TArray<FPICOLayerPtr> PXRLayers_RHIThread;
 	FPICOLayerPtr BlackLayer;
 
@@ -66,9 +73,12 @@ protected:
 	void ToHide();
 	void ReleaseAllTextures();
 	void ReleaseTexture(FPXRSplashLayer& InSplashLayer);
-	void LoadTexture(FPXRSplashLayer& InSplashLayer);
 	void RenderSplashFrame_RenderThread(FRHICommandListImmediate& RHICmdList);
 	IStereoLayers::FLayerDesc CreateStereoLayerDescFromPXRSplashDesc(FPXRSplashDesc PXRSplashDesc);
+	void OnSplashTextureLoaded(FSoftObjectPath TexturePath);
+	void TrimTextureCache();
+	void UpdatePendingLayerTextures_GameThread();
+	void AddReadyPendingLayers_RenderThread();
 
 	TSharedPtr<FSplashTicker_RenderThread> SplashTicker;
 	FCriticalSection RenderThreadLock;
@@ -83,6 +93,33 @@ protected:
 	bool bSplashShouldToShow;
 
 	TArray<FPXRSplashLayer> AddedPXRSplashLayers;
+
+	/** Splash texture kept resident by its streamable handle, evicted least recently used first over vr.PICO.Splash.TextureBudgetMB */
+	struct FSplashTextureEntry
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		UTexture* Texture = nullptr;
+		int64 ResidentBytes = 0;
+		double LastUsedSeconds = 0.0;
+	};
+	FStreamableManager StreamableManager;
+	TMap<FSoftObjectPath, FSplashTextureEntry> SplashTextureCache;
+
+	/** Splash shown before its texture was ready, the render thread adds its layer once the texture is streamed in and has an RHI resource */
+	struct FPendingSplashLayer
+	{
+		uint32 LayerId;
+		FPXRSplashDesc Desc;
+		UTexture* Texture;
+		/** Set by the game thread once every mip of Texture is resident */
+		bool bTextureStreamedIn;
+	};
+	TArray<FPendingSplashLayer> PendingSplashLayers;
+	uint64 ShowStartCycles;
+	bool bFirstSplashFrameReported;
+
+	FPXRSplashPacer SplashPacer;
+	uint32 HandoffFrameNumber;
 	TArray<FPICOLayerPtr> PXRLayers_RenderThread_Entry;
 	TArray<FPICOLayerPtr> PXRLayers_RenderThread;
 
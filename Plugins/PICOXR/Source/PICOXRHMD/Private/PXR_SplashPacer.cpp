@@ -0,0 +1,79 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "PXR_SplashPacer.h"
+
+FPXRSplashPacer::FPXRSplashPacer()
+	: FramePeriodSeconds(1.0 / 72.0)
+	, FrameRateDivisor(1)
+	, LastFrameSeconds(0.0)
+	, LastPredictedDisplayTimeMs(0.0)
+{
+}
+
+void FPXRSplashPacer::Reset(double InDisplayRefreshRate, int32 InFrameRateDivisor)
+{
+	check(IsInRenderingThread());
+	FramePeriodSeconds = 1.0 / (InDisplayRefreshRate > 0.0 ? InDisplayRefreshRate : 72.0);
+	FrameRateDivisor = FMath::Max(InFrameRateDivisor, 1);
+	LastFrameSeconds = 0.0;
+	LastPredictedDisplayTimeMs = 0.0;
+	for (FThreadSafeCounter& Count : IntervalCounts)
+	{
+		Count.Reset();
+	}
+	NumFrames.Reset();
+	MaxIntervalUs.Reset();
+}
+
+bool FPXRSplashPacer::ShouldStartFrame(double NowSeconds, int32 FramesOutstanding) const
+{
+	check(IsInRenderingThread());
+	if (FramesOutstanding > 0)
+	{
+		return false;
+	}
+	if (LastFrameSeconds == 0.0)
+	{
+		return true;
+	}
+	// Half a display frame early, the runtime's frame wait lines the frame up with the display
+	return NowSeconds - LastFrameSeconds >= (FrameRateDivisor - 0.5) * FramePeriodSeconds;
+}
+
+void FPXRSplashPacer::OnFrameStarted(double NowSeconds, uint32 FrameNumber, double PredictedDisplayTimeMs)
+{
+	check(IsInRenderingThread());
+	if (LastFrameSeconds != 0.0)
+	{
+		// The displayed gap is what the player sees, the CPU side gap only stands in when the runtime has no prediction
+		double IntervalSeconds = NowSeconds - LastFrameSeconds;
+		if (PredictedDisplayTimeMs > LastPredictedDisplayTimeMs && LastPredictedDisplayTimeMs > 0.0)
+		{
+			IntervalSeconds = (PredictedDisplayTimeMs - LastPredictedDisplayTimeMs) / 1000.0;
+		}
+		const int32 DisplayFrames = FMath::Max(FMath::RoundToInt((float)(IntervalSeconds / FramePeriodSeconds)), 1);
+		const int32 Bucket = DisplayFrames <= 4 ? DisplayFrames - 1 : (DisplayFrames <= 8 ? 4 : 5);
+		IntervalCounts[Bucket].Increment();
+		NumFrames.Increment();
+		MaxIntervalUs.Set(FMath::Max(MaxIntervalUs.GetValue(), (int32)FMath::Min(IntervalSeconds * 1000000.0, (double)MAX_int32)));
+	}
+	LastFrameSeconds = NowSeconds;
+	LastPredictedDisplayTimeMs = PredictedDisplayTimeMs;
+	LastFrameNumber.Set((int32)FrameNumber);
+}
+
+void FPXRSplashPacer::GetIntervalHistogram(FIntervalHistogram& OutHistogram) const
+{
+	for (int32 Bucket = 0; Bucket < NumIntervalBuckets; Bucket++)
+	{
+		OutHistogram.Counts[Bucket] = IntervalCounts[Bucket].GetValue();
+	}
+	OutHistogram.NumFrames = NumFrames.GetValue();
+	OutHistogram.MaxIntervalMs = MaxIntervalUs.GetValue() / 1000.f;
+}
+
+const TCHAR* FPXRSplashPacer::GetIntervalBucketName(int32 Bucket)
+{
+	static const TCHAR* Names[NumIntervalBuckets] = { TEXT("1"), TEXT("2"), TEXT("3"), TEXT("4"), TEXT("5-8"), TEXT(">8") };
+	return Names[FMath::Clamp(Bucket, 0, NumIntervalBuckets - 1)];
+}
@@ -0,0 +1,53 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+
+/**
+ * Paces the frames the splash submits while a level loads. Frames are started every FrameRateDivisor display frames, so
+ * the loading threads get the CPU and GPU time in between, and the gaps between the submitted frames are kept as a
+ * histogram in display frames, taken from the runtime's display time predictions.
+ * Reset, ShouldStartFrame and OnFrameStarted run on the render thread, the histogram can be read from any thread.
+ */
+class FPXRSplashPacer
+{
+public:
+	/** Gaps of 1, 2, 3, 4, 5 to 8 and more than 8 display frames */
+	enum { NumIntervalBuckets = 6 };
+
+	struct FIntervalHistogram
+	{
+		int32 Counts[NumIntervalBuckets];
+		int32 NumFrames;
+		float MaxIntervalMs;
+	};
+
+	FPXRSplashPacer();
+
+	void Reset(double InDisplayRefreshRate, int32 InFrameRateDivisor);
+
+	/** Whether a splash frame is due, given the frames begun on the render thread and not yet on the RHI thread */
+	bool ShouldStartFrame(double NowSeconds, int32 FramesOutstanding) const;
+
+	/** Called once the runtime has predicted when the splash frame will be displayed, 0 if it did not */
+	void OnFrameStarted(double NowSeconds, uint32 FrameNumber, double PredictedDisplayTimeMs);
+
+	uint32 GetLastFrameNumber() const { return (uint32)LastFrameNumber.GetValue(); }
+
+	void GetIntervalHistogram(FIntervalHistogram& OutHistogram) const;
+
+	static const TCHAR* GetIntervalBucketName(int32 Bucket);
+
+private:
+	double FramePeriodSeconds;
+	int32 FrameRateDivisor;
+	double LastFrameSeconds;
+	double LastPredictedDisplayTimeMs;
+
+	FThreadSafeCounter LastFrameNumber;
+	FThreadSafeCounter IntervalCounts[NumIntervalBuckets];
+	FThreadSafeCounter NumFrames;
+	/** In microseconds so it fits a counter */
+	FThreadSafeCounter MaxIntervalUs;
+};
@@ -11,6 +11,7 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "XRThreadUtils.h"
 #include "PXR_GameFrame.h"
+#include "PXR_MockRuntime.h"
 
 #if PLATFORM_ANDROID
 #include "OpenGLDrvPrivate.h"
@@ -52,6 +53,7 @@ FPICOXRStereoLayer::FPICOXRStereoLayer(FPICOXRHMD* InHMDDevice, uint32 InPXRLaye
     , HMDDevice(InHMDDevice)
 	, ID(InPXRLayerId)
 	, PxrLayerID(0)
+	, DescVersion(0)
     , bTextureNeedUpdate(false)
     , UnderlayMeshComponent(NULL)
     , UnderlayActor(NULL)
@@ -73,6 +75,7 @@ FPICOXRStereoLayer::FPICOXRStereoLayer(const FPICOXRStereoLayer& InPXRLayer)
     , HMDDevice(InPXRLayer.HMDDevice)
 	, ID(InPXRLayer.ID)
 	, PxrLayerID(InPXRLayer.PxrLayerID)
+	, DescVersion(InPXRLayer.DescVersion)
     , LayerDesc(InPXRLayer.LayerDesc)
     , SwapChain(InPXRLayer.SwapChain)
     , LeftSwapChain(InPXRLayer.LeftSwapChain)
@@ -103,6 +106,7 @@ void FPICOXRStereoLayer::SetPXRLayerDesc(const IStereoLayers::FLayerDesc& InDesc
 		bTextureNeedUpdate = true;
 	}
 	LayerDesc = InDesc;
+	DescVersion++;
 
 	ManageUnderlayComponent();
 }
@@ -375,7 +379,7 @@ bool FPICOXRStereoLayer::InitPXRLayer_RenderThread(FPICOXRRenderBridge* CustomPr
 			MSAAValue = HMDDevice->GetMSAAValue();
 		}
 
-		if (CustomPresent->RHIString == TEXT("Vulkan"))
+		if (CustomPresent && CustomPresent->RHIString == TEXT("Vulkan"))
 		{
 			bNeedFFRSwapChain = true;
 		}
@@ -573,6 +577,24 @@ bool FPICOXRStereoLayer::InitPXRLayer_RenderThread(FPICOXRRenderBridge* CustomPr
 			PXR_LOGE(PxrUnreal, "Create SwapChain failed!");
 			return false;
 		}
+#elif PICOXR_MOCK_RUNTIME
+		ExecuteOnRHIThread([&]()
+			{
+				PxrLayerID = PxrLayerIDCounter;
+				if (FPXRMockRuntime::Get().CreateLayer(PxrLayerID) == 0)
+				{
+					PxrLayerIDCounter++;
+					bNativeTextureCreated = true;
+				}
+			});
+
+		if (!bNativeTextureCreated)
+		{
+			PXR_LOGE(PxrUnreal, "MockRuntime CreateLayer failed!");
+			return false;
+		}
+		PxrLayer = MakeShareable<FPxrLayer>(new FPxrLayer(PxrLayerID, DelayDeletion));
+		bTextureNeedUpdate = true;
 #endif
 	}            
 	if ((LayerDesc.Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE) && LayerDesc.Texture.IsValid() && IsVisible())
@@ -907,6 +929,8 @@ void FPICOXRStereoLayer::SubmitLayer_RHIThread(FPXRGameFrame* Frame)
 			}
 		}
 	}
+#elif PICOXR_MOCK_RUNTIME
+	FPXRMockRuntime::Get().SubmitLayer(PxrLayerID);
 #endif
 }
 
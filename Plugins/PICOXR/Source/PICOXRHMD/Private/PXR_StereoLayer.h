@@ -41,6 +41,8 @@ public:
 	void SetPXRLayerDesc(const IStereoLayers::FLayerDesc& InDesc);
 	const IStereoLayers::FLayerDesc& GetPXRLayerDesc() const { return LayerDesc; }
 	const uint32& GetID()const{return ID;}
+	// Bumped on every descriptor change, copies keep it so threads can tell whether their copy is stale
+	uint32 GetDescVersion() const { return DescVersion; }
 
 	bool IsLayerSupportDepth() { return (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_SUPPORT_DEPTH) != 0; }
 	void ManageUnderlayComponent();
@@ -55,6 +57,7 @@ public:
 	void SetProjectionLayerParams(uint32 SizeX, uint32 SizeY, uint32 ArraySize, uint32 NumMips, uint32 NumSamples, FString RHIString);
     void PXRLayersCopy_RenderThread(FPICOXRRenderBridge* RenderBridge, FRHICommandListImmediate& RHICmdList);
 	void MarkTextureForUpdate(bool bUpdate = true) { bTextureNeedUpdate = bUpdate; }
+	bool IsTextureNeedUpdate() const { return bTextureNeedUpdate; }
 	bool InitPXRLayer_RenderThread(FPICOXRRenderBridge* CustomPresent, FDelayDeleteLayerManager* DelayDeletion, FRHICommandListImmediate& RHICmdList, const FPICOXRStereoLayer* InLayer = nullptr);
 	bool IfCanReuseLayers(const FPICOXRStereoLayer* InLayer) const;
 	bool IsVisible() { return (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_HIDDEN) == 0; }
@@ -71,6 +74,7 @@ protected:
 	uint32 ID;	
 	uint32 PxrLayerID;
 	static uint32 PxrLayerIDCounter;
+	uint32 DescVersion;
 	IStereoLayers::FLayerDesc LayerDesc;
 	FXRSwapChainPtr SwapChain;
 	FXRSwapChainPtr LeftSwapChain;
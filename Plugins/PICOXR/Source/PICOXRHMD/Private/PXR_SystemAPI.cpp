@@ -1,10 +1,100 @@
 //Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
 #include "PXR_SystemAPI.h"
+#include "Async/Async.h"
+#include "PXR_SystemAPIWorker.h"
 #if PLATFORM_ANDROID
 #include "Android/AndroidApplication.h"
 #include "Android/AndroidJNI.h"
 #endif
 
+#if PLATFORM_ANDROID
+// Methods behind the getters that are polled, resolved together once instead of on each getter's first call
+struct FPXRSystemAPIMethods
+{
+	jmethodID GetDeviceInfo;
+	jmethodID GetCpuUsages;
+	jmethodID GetDeviceTemperatures;
+	jmethodID GetCurrentBrightness;
+	jmethodID GetCurrentVolume;
+	jmethodID GetMaxVolumeNumber;
+
+	explicit FPXRSystemAPIMethods(JNIEnv* Env)
+		: GetDeviceInfo(FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetDeviceInfo", "(I)Ljava/lang/String;", false))
+		, GetCpuUsages(FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetCpuUsages", "()[F", false))
+		, GetDeviceTemperatures(FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetDeviceTemperatures", "(II)[F", false))
+		, GetCurrentBrightness(FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetCurrentBrightness", "()I", false))
+		, GetCurrentVolume(FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetCurrentVolume", "()I", false))
+		, GetMaxVolumeNumber(FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetMaxVolumeNumber", "()I", false))
+	{
+	}
+};
+
+static const FPXRSystemAPIMethods& GetSystemAPIMethods(JNIEnv* Env)
+{
+	// The game thread and the system API worker can both get here first, static initialisation is thread safe
+	static const FPXRSystemAPIMethods Methods(Env);
+	return Methods;
+}
+
+static void ReadFloatArray(JNIEnv* Env, jfloatArray Array, TArray<float>& OutData)
+{
+	OutData.Reset();
+	if (Array != NULL)
+	{
+		OutData.SetNumUninitialized(Env->GetArrayLength(Array));
+		Env->GetFloatArrayRegion(Array, 0, OutData.Num(), OutData.GetData());
+	}
+}
+#endif
+
+static FString ReadDeviceInfo(ESystemInfoEnum InfoEnum)
+{
+	FString Result = FString("");
+	if (FPXRSystemPropertyCache::Get().Find((int32)InfoEnum, Result))
+	{
+		return Result;
+	}
+#if PLATFORM_ANDROID
+	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
+	{
+		jstring JavaString = (jstring)FJavaWrapper::CallObjectMethod(Env, FJavaWrapper::GameActivityThis, GetSystemAPIMethods(Env).GetDeviceInfo, static_cast<int32>(InfoEnum));
+		if (JavaString != NULL)
+		{
+			const char* JavaChars = Env->GetStringUTFChars(JavaString, 0);
+			Result = FString(UTF8_TO_TCHAR(JavaChars));
+			Env->ReleaseStringUTFChars(JavaString, JavaChars);
+			Env->DeleteLocalRef(JavaString);
+		}
+	}
+#endif
+	FPXRSystemPropertyCache::Get().Store((int32)InfoEnum, Result);
+	return Result;
+}
+
+static void ReadCpuUsages(TArray<float>& OutData)
+{
+	OutData.Reset();
+#if PLATFORM_ANDROID
+	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
+	{
+		auto FloatValuesArray = NewScopedJavaObject(Env, (jfloatArray)FJavaWrapper::CallObjectMethod(Env, FJavaWrapper::GameActivityThis, GetSystemAPIMethods(Env).GetCpuUsages));
+		ReadFloatArray(Env, *FloatValuesArray, OutData);
+	}
+#endif
+}
+
+static void ReadDeviceTemperatures(int inType, int inSource, TArray<float>& OutData)
+{
+	OutData.Reset();
+#if PLATFORM_ANDROID
+	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
+	{
+		auto FloatValuesArray = NewScopedJavaObject(Env, (jfloatArray)FJavaWrapper::CallObjectMethod(Env, FJavaWrapper::GameActivityThis, GetSystemAPIMethods(Env).GetDeviceTemperatures, inType, inSource));
+		ReadFloatArray(Env, *FloatValuesArray, OutData);
+	}
+#endif
+}
+
 TMap<EDeviceControlEnum,FPICOSetDeviceActionDelegate> UPICOXRSystemAPI::SetDeviceActionDelegates;
 TMap<FAppManagerStruct,FPICOAppManagerDelegate> UPICOXRSystemAPI::AppManagerDelegates;
 FPICOSetAutoConnectWifiDelegate UPICOXRSystemAPI::SetAutoConnectWifiDelegate;
@@ -45,6 +135,7 @@ void UPICOXRSystemAPI::BeginPlay()
 	{
 		static jmethodID Method = FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "BindSystemAPIService", "()V", false);
 		FJavaWrapper::CallVoidMethod(Env, FJavaWrapper::GameActivityThis, Method);
+		GetSystemAPIMethods(Env);
 	}
 #endif
 }
@@ -71,22 +162,25 @@ void UPICOXRSystemAPI::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 
 FString UPICOXRSystemAPI::PXR_GetDeviceInfo(ESystemInfoEnum InfoEnum)
 {
-	FString Result = FString("");
-#if PLATFORM_ANDROID
-	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
+	return ReadDeviceInfo(InfoEnum);
+}
+
+void UPICOXRSystemAPI::PXR_GetDeviceInfoAsync(ESystemInfoEnum InfoEnum, FPICOGetDeviceInfoDelegate GetDeviceInfoDelegate)
+{
+	FString Result;
+	if (FPXRSystemPropertyCache::Get().Find((int32)InfoEnum, Result))
 	{
-		static jmethodID Method = FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetDeviceInfo", "(I)Ljava/lang/String;", false);
-		jstring JavaString = (jstring)FJavaWrapper::CallObjectMethod(Env, FJavaWrapper::GameActivityThis, Method, static_cast<int32>(InfoEnum));
-		if (JavaString != NULL)
-		{
-			const char* JavaChars = Env->GetStringUTFChars(JavaString, 0);
-			Result = FString(UTF8_TO_TCHAR(JavaChars));
-			Env->ReleaseStringUTFChars(JavaString, JavaChars);
-			Env->DeleteLocalRef(JavaString);
-		}
+		GetDeviceInfoDelegate.ExecuteIfBound(Result);
+		return;
 	}
-#endif
-	return  Result;
+	FPXRSystemAPIWorker::Get().Enqueue([InfoEnum, GetDeviceInfoDelegate]()
+	{
+		const FString WorkerResult = ReadDeviceInfo(InfoEnum);
+		AsyncTask(ENamedThreads::GameThread, [GetDeviceInfoDelegate, WorkerResult]()
+		{
+			GetDeviceInfoDelegate.ExecuteIfBound(WorkerResult);
+		});
+	});
 }
 
 void UPICOXRSystemAPI::PXR_SetDeviceAction(EDeviceControlEnum DeviceControlEnum,FPICOSetDeviceActionDelegate SetDeviceActionDelegate)
@@ -376,8 +470,7 @@ int32 UPICOXRSystemAPI::PXR_GetCurrentBrightness()
 #if PLATFORM_ANDROID
 	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
 	{
-		static jmethodID Method = FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetCurrentBrightness", "()I", false);
-		currentBrightness = (int32)FJavaWrapper::CallIntMethod(Env, FJavaWrapper::GameActivityThis, Method);
+		currentBrightness = (int32)FJavaWrapper::CallIntMethod(Env, FJavaWrapper::GameActivityThis, GetSystemAPIMethods(Env).GetCurrentBrightness);
 	}
 #endif
 	return currentBrightness;
@@ -401,8 +494,7 @@ int32 UPICOXRSystemAPI::PXR_GetCurrentVolume()
 	
 	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
 	{
-		static jmethodID Method = FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetCurrentVolume", "()I", false);
-		currentVolume = (int32)FJavaWrapper::CallIntMethod(Env, FJavaWrapper::GameActivityThis, Method);
+		currentVolume = (int32)FJavaWrapper::CallIntMethod(Env, FJavaWrapper::GameActivityThis, GetSystemAPIMethods(Env).GetCurrentVolume);
 	}
 #endif
 	return currentVolume;
@@ -411,13 +503,21 @@ int32 UPICOXRSystemAPI::PXR_GetCurrentVolume()
 int32 UPICOXRSystemAPI::PXR_GetMaxVolume()
 {
 	int32 maxVolume = -1;
+	FString CachedMaxVolume;
+	if (FPXRSystemPropertyCache::Get().Find(FPXRSystemPropertyCache::MaxVolume, CachedMaxVolume))
+	{
+		return FCString::Atoi(*CachedMaxVolume);
+	}
 #if PLATFORM_ANDROID
 	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
 	{
-		static jmethodID Method = FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetMaxVolumeNumber", "()I", false);
-		maxVolume = (int32)FJavaWrapper::CallIntMethod(Env, FJavaWrapper::GameActivityThis, Method);
+		maxVolume = (int32)FJavaWrapper::CallIntMethod(Env, FJavaWrapper::GameActivityThis, GetSystemAPIMethods(Env).GetMaxVolumeNumber);
 	}
 #endif
+	if (maxVolume > 0)
+	{
+		FPXRSystemPropertyCache::Get().Store(FPXRSystemPropertyCache::MaxVolume, FString::FromInt(maxVolume));
+	}
 	return maxVolume;
 }
 
@@ -458,23 +558,7 @@ void UPICOXRSystemAPI::PXR_VolumeDown()
 
 FString UPICOXRSystemAPI::PXR_GetDeviceSN()
 {
-	ESystemInfoEnum systemInfo = ESystemInfoEnum::EQUIPMENT_SN;
-	FString result = FString("");
-#if PLATFORM_ANDROID
-	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
-	{
-		static jmethodID Method = FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetDeviceInfo", "(I)Ljava/lang/String;", false);
-		jstring JavaString = (jstring)FJavaWrapper::CallObjectMethod(Env, FJavaWrapper::GameActivityThis, Method, static_cast<int32>(systemInfo));
-		if (JavaString != NULL)
-		{
-			const char* JavaChars = Env->GetStringUTFChars(JavaString, 0);
-			result = FString(UTF8_TO_TCHAR(JavaChars));
-			Env->ReleaseStringUTFChars(JavaString, JavaChars);
-			Env->DeleteLocalRef(JavaString);
-		}
-}
-#endif
-	return result;
+	return ReadDeviceInfo(ESystemInfoEnum::EQUIPMENT_SN);
 }
 
 void UPICOXRSystemAPI::PXR_FreezeScreen(bool freeze)
@@ -779,40 +863,38 @@ void UPICOXRSystemAPI::PXR_ImportMaps(FPICOImportMapsDelegate InImportMapsDelega
 
 void UPICOXRSystemAPI::PXR_GetCpuUsages(TArray<float>& OutData)
 {
-#if PLATFORM_ANDROID
-	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
+	ReadCpuUsages(OutData);
+}
+
+void UPICOXRSystemAPI::PXR_GetCpuUsagesAsync(FPICOGetFloatArrayDelegate GetCpuUsagesDelegate)
+{
+	FPXRSystemAPIWorker::Get().Enqueue([GetCpuUsagesDelegate]()
 	{
-		static jmethodID Method = FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetCpuUsages", "()[F", false);
-		auto FloatValuesArray = NewScopedJavaObject(Env, (jfloatArray)FJavaWrapper::CallObjectMethod(Env, FJavaWrapper::GameActivityThis, Method));
-		jfloat* FloatValues = Env->GetFloatArrayElements(*FloatValuesArray, 0);
-		jsize NumProducts = Env->GetArrayLength(*FloatValuesArray);
-		OutData.Empty();
-		for (int i = 0; i < NumProducts; i++)
+		TArray<float> Data;
+		ReadCpuUsages(Data);
+		AsyncTask(ENamedThreads::GameThread, [GetCpuUsagesDelegate, Data = MoveTemp(Data)]()
 		{
-			UE_LOG(LogHMD, Log, TEXT("Data[%d]:%f"), i, FloatValues[i]);
-			OutData.Add(FloatValues[i]);
-		}
-	}
-#endif
+			GetCpuUsagesDelegate.ExecuteIfBound(Data);
+		});
+	});
 }
 
 void UPICOXRSystemAPI::PXR_GetDeviceTemperatures(int inType, int inSource, TArray<float>& OutData)
 {
-#if PLATFORM_ANDROID
-	if (JNIEnv* Env = FAndroidApplication::GetJavaEnv())
+	ReadDeviceTemperatures(inType, inSource, OutData);
+}
+
+void UPICOXRSystemAPI::PXR_GetDeviceTemperaturesAsync(int inType, int inSource, FPICOGetFloatArrayDelegate GetDeviceTemperaturesDelegate)
+{
+	FPXRSystemAPIWorker::Get().Enqueue([inType, inSource, GetDeviceTemperaturesDelegate]()
 	{
-		static jmethodID Method = FJavaWrapper::FindMethod(Env, FJavaWrapper::GameActivityClassID, "GetDeviceTemperatures", "(II)[F", false);
-		auto FloatValuesArray = NewScopedJavaObject(Env, (jfloatArray)FJavaWrapper::CallObjectMethod(Env, FJavaWrapper::GameActivityThis, Method, inType, inSource));
-		jfloat* FloatValues = Env->GetFloatArrayElements(*FloatValuesArray, 0);
-		jsize NumProducts = Env->GetArrayLength(*FloatValuesArray);
-		OutData.Empty();
-		for (int i = 0; i < NumProducts; i++)
+		TArray<float> Data;
+		ReadDeviceTemperatures(inType, inSource, Data);
+		AsyncTask(ENamedThreads::GameThread, [GetDeviceTemperaturesDelegate, Data = MoveTemp(Data)]()
 		{
-			UE_LOG(LogHMD, Log, TEXT("Data[%d]:%f"), i, FloatValues[i]);
-			OutData.Add(FloatValues[i]);
-		}
-	}
-#endif
+			GetDeviceTemperaturesDelegate.ExecuteIfBound(Data);
+		});
+	});
 }
 
 void UPICOXRSystemAPI::PXR_Capture()
@@ -329,6 +329,8 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FPICOGetSwitchSystemFunctionStatusDelegate, in
 DECLARE_DYNAMIC_DELEGATE_OneParam(FPICOCastInitDelegate, ECastInitResult, Result);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FPICOSetControllerPairTimeDelegate, int32, Result);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FPICOGetControllerPairTimeDelegate, EControllerPairTimeEnum, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FPICOGetDeviceInfoDelegate, const FString, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FPICOGetFloatArrayDelegate, const TArray<float>&, Data);
 
 UCLASS(ClassGroup = (PXRComponent), meta = (BlueprintSpawnableComponent))
 class PICOXRHMD_API UPICOXRSystemAPI : public UActorComponent
@@ -352,6 +354,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PXR|PXRSystemAPI")
 	FString PXR_GetDeviceInfo(ESystemInfoEnum InfoEnum);
 
+	/** Same as PXR_GetDeviceInfo without blocking the caller, the delegate runs on the game thread */
+	UFUNCTION(BlueprintCallable, Category = "PXR|PXRSystemAPI")
+	void PXR_GetDeviceInfoAsync(ESystemInfoEnum InfoEnum, FPICOGetDeviceInfoDelegate GetDeviceInfoDelegate);
+
 	static TMap<EDeviceControlEnum, FPICOSetDeviceActionDelegate> SetDeviceActionDelegates;
 	UFUNCTION(BlueprintCallable, Category = "PXR|PXRSystemAPI")
 	void PXR_SetDeviceAction(EDeviceControlEnum DeviceControlEnum, FPICOSetDeviceActionDelegate SetDeviceActionDelegate);
@@ -527,9 +533,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PXR|PXRSystemAPI")
 	void PXR_GetCpuUsages(TArray<float> &OutData);
 
+	/** Same as PXR_GetCpuUsages without blocking the caller, the delegate runs on the game thread */
+	UFUNCTION(BlueprintCallable, Category = "PXR|PXRSystemAPI")
+	void PXR_GetCpuUsagesAsync(FPICOGetFloatArrayDelegate GetCpuUsagesDelegate);
+
 	UFUNCTION(BlueprintCallable, Category = "PXR|PXRSystemAPI")
 	void PXR_GetDeviceTemperatures(int inType, int inSource,TArray<float> &OutData);
 
+	/** Same as PXR_GetDeviceTemperatures without blocking the caller, the delegate runs on the game thread */
+	UFUNCTION(BlueprintCallable, Category = "PXR|PXRSystemAPI")
+	void PXR_GetDeviceTemperaturesAsync(int inType, int inSource, FPICOGetFloatArrayDelegate GetDeviceTemperaturesDelegate);
+
 	UFUNCTION(BlueprintCallable, Category = "PXR|PXRSystemAPI")
 	void PXR_Capture();
 	
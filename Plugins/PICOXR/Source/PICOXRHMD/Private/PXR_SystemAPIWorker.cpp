@@ -0,0 +1,140 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#include "PXR_SystemAPIWorker.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "PXR_Log.h"
+#include "PXR_SystemAPI.h"
+
+static TAutoConsoleVariable<float> CVarPICOSystemAPIPropertyCacheTTL(
+	TEXT("vr.PICO.SystemAPI.PropertyCacheTTL"),
+	2.0f,
+	TEXT("Seconds a changing device property (battery, charging, network state) read through the PICO system API is reused. 0 reads it on every call."),
+	ECVF_Default);
+
+static FCriticalSection GSystemAPIWorkerLock;
+static TUniquePtr<FPXRSystemAPIWorker> GSystemAPIWorker;
+
+FPXRSystemAPIWorker& FPXRSystemAPIWorker::Get()
+{
+	FScopeLock ScopeLock(&GSystemAPIWorkerLock);
+	if (!GSystemAPIWorker.IsValid())
+	{
+		GSystemAPIWorker.Reset(new FPXRSystemAPIWorker());
+	}
+	return *GSystemAPIWorker;
+}
+
+void FPXRSystemAPIWorker::Shutdown()
+{
+	FScopeLock ScopeLock(&GSystemAPIWorkerLock);
+	GSystemAPIWorker.Reset();
+}
+
+FPXRSystemAPIWorker::FPXRSystemAPIWorker()
+	: WorkEvent(FPlatformProcess::GetSynchEventFromPool())
+	, Thread(nullptr)
+	, bStopping(false)
+{
+	Thread = FRunnableThread::Create(this, TEXT("PICOXRSystemAPIWorker"), 0, TPri_BelowNormal);
+}
+
+FPXRSystemAPIWorker::~FPXRSystemAPIWorker()
+{
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	WorkEvent = nullptr;
+}
+
+void FPXRSystemAPIWorker::Enqueue(TFunction<void()>&& Task)
+{
+	Tasks.Enqueue(MoveTemp(Task));
+	WorkEvent->Trigger();
+}
+
+uint32 FPXRSystemAPIWorker::Run()
+{
+	TFunction<void()> Task;
+	for (;;)
+	{
+		while (Tasks.Dequeue(Task))
+		{
+			Task();
+			Task = nullptr;
+		}
+		if (bStopping)
+		{
+			break;
+		}
+		WorkEvent->Wait();
+	}
+	return 0;
+}
+
+void FPXRSystemAPIWorker::Stop()
+{
+	bStopping = true;
+	WorkEvent->Trigger();
+}
+
+FPXRSystemPropertyCache& FPXRSystemPropertyCache::Get()
+{
+	static FPXRSystemPropertyCache Cache;
+	return Cache;
+}
+
+double FPXRSystemPropertyCache::GetTimeToLiveSeconds(int32 PropertyId)
+{
+	switch (PropertyId)
+	{
+	case (int32)ESystemInfoEnum::PUI_VERSION:
+	case (int32)ESystemInfoEnum::EQUIPMENT_MODEL:
+	case (int32)ESystemInfoEnum::EQUIPMENT_SN:
+	case (int32)ESystemInfoEnum::CUSTOMER_SN:
+	case (int32)ESystemInfoEnum::BLUETOOTH_MAC_ADDRESS:
+	case (int32)ESystemInfoEnum::WLAN_MAC_ADDRESS:
+	case MaxVolume:
+		return MAX_dbl;
+	default:
+		return CVarPICOSystemAPIPropertyCacheTTL.GetValueOnAnyThread();
+	}
+}
+
+bool FPXRSystemPropertyCache::Find(int32 PropertyId, FString& OutValue)
+{
+	FScopeLock ScopeLock(&Lock);
+	const FEntry* Entry = Entries.Find(PropertyId);
+	if (Entry && FPlatformTime::Seconds() < Entry->ExpireTimeSeconds)
+	{
+		OutValue = Entry->Value;
+		return true;
+	}
+	return false;
+}
+
+void FPXRSystemPropertyCache::Store(int32 PropertyId, const FString& Value)
+{
+	const double TimeToLive = GetTimeToLiveSeconds(PropertyId);
+	if (TimeToLive <= 0.0)
+	{
+		return;
+	}
+	// An empty string is what the calls return before the system service is bound, never keep it
+	if (Value.IsEmpty())
+	{
+		return;
+	}
+	FScopeLock ScopeLock(&Lock);
+	FEntry& Entry = Entries.FindOrAdd(PropertyId);
+	Entry.Value = Value;
+	Entry.ExpireTimeSeconds = TimeToLive == MAX_dbl ? MAX_dbl : FPlatformTime::Seconds() + TimeToLive;
+}
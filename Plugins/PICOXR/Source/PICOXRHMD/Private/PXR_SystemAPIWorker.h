@@ -0,0 +1,69 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+
+class FRunnableThread;
+class FEvent;
+
+/**
+ * Dedicated thread that runs system API calls off the game thread, one at a time and in submission order.
+ * Tasks run on the worker; anything they hand back to Blueprint has to be marshalled to the game thread by the task.
+ */
+class FPXRSystemAPIWorker : public FRunnable
+{
+public:
+	/** Starts the thread on first use */
+	static FPXRSystemAPIWorker& Get();
+	/** Runs the tasks still queued and joins the thread */
+	static void Shutdown();
+
+	void Enqueue(TFunction<void()>&& Task);
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	virtual ~FPXRSystemAPIWorker();
+
+private:
+	FPXRSystemAPIWorker();
+
+	TQueue<TFunction<void()>, EQueueMode::Mpsc> Tasks;
+	FEvent* WorkEvent;
+	FRunnableThread* Thread;
+	FThreadSafeBool bStopping;
+};
+
+/**
+ * Device properties read through the system API, kept for a time to live that depends on how often they can change.
+ * Identifiers such as the serial number or device model never expire, battery or network state use
+ * vr.PICO.SystemAPI.PropertyCacheTTL. Thread safe, the worker fills it while the game thread reads it.
+ */
+class FPXRSystemPropertyCache
+{
+public:
+	static FPXRSystemPropertyCache& Get();
+
+	/** Property IDs past the ESystemInfoEnum values, for the properties that are not read through GetDeviceInfo */
+	enum : int32
+	{
+		MaxVolume = 256,
+	};
+
+	bool Find(int32 PropertyId, FString& OutValue);
+	void Store(int32 PropertyId, const FString& Value);
+
+private:
+	struct FEntry
+	{
+		FString Value;
+		double ExpireTimeSeconds;
+	};
+
+	static double GetTimeToLiveSeconds(int32 PropertyId);
+
+	FCriticalSection Lock;
+	TMap<int32, FEntry> Entries;
+};
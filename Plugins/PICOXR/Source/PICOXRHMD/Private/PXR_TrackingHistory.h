@@ -0,0 +1,191 @@
+//Unreal® Engine, Copyright 1998 – 2022, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+#include "PXR_HMDFunctionLibrary.h"
+
+/** One face tracking reading, laid out like PxrFTInfo so it is filled with plain copies */
+struct FPXRFaceTrackingSample
+{
+	enum
+	{
+		NumBlendShapes = 72,
+		NumVideoInputs = 10,
+		NumEmotions = 10,
+		NumReserved = 128,
+	};
+
+	/** FPlatformTime::Seconds() when the sample was read, the time samples are interpolated at */
+	double TimeSeconds = 0.0;
+	/** Timestamp the runtime reported for the reading */
+	int64 RuntimeTimestamp = 0;
+	float BlendShapeWeight[NumBlendShapes];
+	float VideoInputValid[NumVideoInputs];
+	float LaughingProb = 0.f;
+	float EmotionProb[NumEmotions];
+	float Reserved[NumReserved];
+
+	static void Interpolate(const FPXRFaceTrackingSample& A, const FPXRFaceTrackingSample& B, float Alpha, FPXRFaceTrackingSample& Out)
+	{
+		// Validity flags and reserved values are not interpolated
+		Out = Alpha < 0.5f ? A : B;
+		for (int32 Index = 0; Index < NumBlendShapes; Index++)
+		{
+			Out.BlendShapeWeight[Index] = FMath::Lerp(A.BlendShapeWeight[Index], B.BlendShapeWeight[Index], Alpha);
+		}
+		for (int32 Index = 0; Index < NumEmotions; Index++)
+		{
+			Out.EmotionProb[Index] = FMath::Lerp(A.EmotionProb[Index], B.EmotionProb[Index], Alpha);
+		}
+		Out.LaughingProb = FMath::Lerp(A.LaughingProb, B.LaughingProb, Alpha);
+		Out.TimeSeconds = FMath::Lerp(A.TimeSeconds, B.TimeSeconds, (double)Alpha);
+	}
+};
+
+/** One eye tracking reading */
+struct FPXREyeTrackingSample
+{
+	double TimeSeconds = 0.0;
+	FPICOXREyeTrackingData Data;
+
+	FPXREyeTrackingSample()
+	{
+		FMemory::Memzero(Data);
+	}
+
+	static void Interpolate(const FPXREyeTrackingSample& A, const FPXREyeTrackingSample& B, float Alpha, FPXREyeTrackingSample& Out)
+	{
+		// Pose status and tracking state come from the nearer sample
+		Out = Alpha < 0.5f ? A : B;
+		FPICOXREyeTrackingData& Data = Out.Data;
+		Data.LeftEyeGazePoint = FMath::Lerp(A.Data.LeftEyeGazePoint, B.Data.LeftEyeGazePoint, Alpha);
+		Data.RightEyeGazePoint = FMath::Lerp(A.Data.RightEyeGazePoint, B.Data.RightEyeGazePoint, Alpha);
+		Data.CombinedEyeGazePoint = FMath::Lerp(A.Data.CombinedEyeGazePoint, B.Data.CombinedEyeGazePoint, Alpha);
+		Data.LeftEyeGazeVector = FMath::Lerp(A.Data.LeftEyeGazeVector, B.Data.LeftEyeGazeVector, Alpha).GetSafeNormal();
+		Data.RightEyeGazeVector = FMath::Lerp(A.Data.RightEyeGazeVector, B.Data.RightEyeGazeVector, Alpha).GetSafeNormal();
+		Data.CombinedEyeGazeVector = FMath::Lerp(A.Data.CombinedEyeGazeVector, B.Data.CombinedEyeGazeVector, Alpha).GetSafeNormal();
+		Data.FoveatedGazeDirection = FMath::Lerp(A.Data.FoveatedGazeDirection, B.Data.FoveatedGazeDirection, Alpha).GetSafeNormal();
+		Data.LeftEyeOpenness = FMath::Lerp(A.Data.LeftEyeOpenness, B.Data.LeftEyeOpenness, Alpha);
+		Data.RightEyeOpenness = FMath::Lerp(A.Data.RightEyeOpenness, B.Data.RightEyeOpenness, Alpha);
+		Data.LeftEyePupilDilation = FMath::Lerp(A.Data.LeftEyePupilDilation, B.Data.LeftEyePupilDilation, Alpha);
+		Data.RightEyePupilDilation = FMath::Lerp(A.Data.RightEyePupilDilation, B.Data.RightEyePupilDilation, Alpha);
+		Data.LeftEyePositionGuide = FMath::Lerp(A.Data.LeftEyePositionGuide, B.Data.LeftEyePositionGuide, Alpha);
+		Data.RightEyePositionGuide = FMath::Lerp(A.Data.RightEyePositionGuide, B.Data.RightEyePositionGuide, Alpha);
+		Out.TimeSeconds = FMath::Lerp(A.TimeSeconds, B.TimeSeconds, (double)Alpha);
+	}
+};
+
+/**
+ * Fixed capacity history of timestamped tracking samples. The tracker writes one sample per frame, animation, networking
+ * or recording code reads the newest one, an interpolated one at any time inside the history, or copies a range out.
+ * Storage is allocated once with the history, reads copy into caller owned memory. Thread safe.
+ */
+template<typename SampleType, int32 Capacity>
+class TPXRTrackingHistory
+{
+public:
+	TPXRTrackingHistory()
+		: Samples(new SampleType[Capacity])
+		, NumSamples(0)
+		, NextIndex(0)
+	{
+	}
+
+	/** Samples have to be pushed in increasing TimeSeconds */
+	void Push(const SampleType& Sample)
+	{
+		FScopeLock ScopeLock(&Lock);
+		Samples[NextIndex] = Sample;
+		NextIndex = (NextIndex + 1) % Capacity;
+		NumSamples = FMath::Min(NumSamples + 1, Capacity);
+	}
+
+	void Reset()
+	{
+		FScopeLock ScopeLock(&Lock);
+		NumSamples = 0;
+		NextIndex = 0;
+	}
+
+	bool GetLatest(SampleType& OutSample) const
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (NumSamples == 0)
+		{
+			return false;
+		}
+		OutSample = GetOrdered(NumSamples - 1);
+		return true;
+	}
+
+	/** Interpolates between the samples around TimeSeconds, clamped to the oldest and newest sample */
+	bool Sample(double TimeSeconds, SampleType& OutSample) const
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (NumSamples == 0)
+		{
+			return false;
+		}
+		if (TimeSeconds >= GetOrdered(NumSamples - 1).TimeSeconds)
+		{
+			OutSample = GetOrdered(NumSamples - 1);
+			return true;
+		}
+		if (TimeSeconds <= GetOrdered(0).TimeSeconds)
+		{
+			OutSample = GetOrdered(0);
+			return true;
+		}
+		// First sample newer than TimeSeconds, the history is sorted by time
+		int32 Low = 1;
+		int32 High = NumSamples - 1;
+		while (Low < High)
+		{
+			const int32 Middle = (Low + High) / 2;
+			if (GetOrdered(Middle).TimeSeconds > TimeSeconds)
+			{
+				High = Middle;
+			}
+			else
+			{
+				Low = Middle + 1;
+			}
+		}
+		const SampleType& Before = GetOrdered(Low - 1);
+		const SampleType& After = GetOrdered(Low);
+		const double Span = After.TimeSeconds - Before.TimeSeconds;
+		const float Alpha = Span > 0.0 ? (float)((TimeSeconds - Before.TimeSeconds) / Span) : 1.f;
+		SampleType::Interpolate(Before, After, Alpha, OutSample);
+		return true;
+	}
+
+	/** Appends the samples newer than SinceSeconds, oldest first. A reused array does not allocate once it has grown to Capacity */
+	int32 CopySince(double SinceSeconds, TArray<SampleType>& OutSamples) const
+	{
+		FScopeLock ScopeLock(&Lock);
+		int32 NumCopied = 0;
+		for (int32 Index = 0; Index < NumSamples; Index++)
+		{
+			const SampleType& Sample = GetOrdered(Index);
+			if (Sample.TimeSeconds > SinceSeconds)
+			{
+				OutSamples.Add(Sample);
+				NumCopied++;
+			}
+		}
+		return NumCopied;
+	}
+
+private:
+	/** Index 0 is the oldest sample */
+	const SampleType& GetOrdered(int32 Index) const
+	{
+		return Samples[(NextIndex - NumSamples + Index + Capacity) % Capacity];
+	}
+
+	TUniquePtr<SampleType[]> Samples;
+	int32 NumSamples;
+	int32 NextIndex;
+	mutable FCriticalSection Lock;
+};
@@ -8,6 +8,7 @@
 #include "PXR_HMDTypes.h"
 #include "PXR_HMDFunctionLibrary.generated.h"
 
+class UTexture;
 class UTexture2D;
 
 /* Boundary boundary types*/
@@ -348,6 +349,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "PXR|PXRHMD")
 		static bool GetFocusState();
 
+	/**
+	* Start streaming a splash texture in, so a later splash shows it without loading.
+	* Splash textures set in the project settings are preloaded at startup.
+	* @param SplashTexture  (In) Texture to keep resident for splashes.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "PXR|PXRHMD")
+		static void PXR_PreloadSplashTexture(TSoftObjectPtr<UTexture> SplashTexture);
+
 #pragma region Boundary
 	static class UPICOXRBoundarySystem* GetBoundarySystemInterface();
 	/**
@@ -418,9 +427,10 @@ public:
 		static FVector PXR_GetBoundaryDimensions(EPICOXRBoundaryType BoundaryType);
 
 	/**
-	* Get an image of the device's camera.
+	* Get the newest image of the device's camera without waiting for the camera, and request the next one.
+	* The event manager's SeeThroughFrameReadyDelegate fires when the next image is ready.
 	* @param CameraType			(in) Left or right camera.
-	* @param CameraImage        (out) The image of the device's camera.
+	* @param CameraImage        (out) The image of the device's camera, empty until the camera delivered its first frame.
 	*/
 	UFUNCTION(BlueprintCallable, Category = "PXR|PXRHMD")
 		static bool PXR_GetBoundarySeeThroughData(EPICOXRCameraType CameraType,UTexture2D* &CameraImage);
@@ -498,6 +508,17 @@ public:
 	 //UFUNCTION(BlueprintCallable, Category = "PXR|PXRHMD")
 		 static bool PXR_GetFaceTrackingData(int64 InTimeStamp, int64& OutTimeStamp, TArray<float>& BlendShapeWeight, TArray<float>& VideoInputValid, float &LaughingProb, TArray<float>& EmotionProb, TArray<float>& Reserved);
 
+	/**
+	* Face tracking data interpolated from the samples recorded once per frame, at a FPlatformTime::Seconds() time.
+	* Times outside the recorded history return the nearest sample. Reuses the storage of the arrays passed in.
+	*/
+		 static bool PXR_GetFaceTrackingDataAtTime(double TimeSeconds, int64& OutTimeStamp, TArray<float>& BlendShapeWeight, float &LaughingProb, TArray<float>& EmotionProb);
+
+	/**
+	* Eye tracking data interpolated from the samples recorded once per frame, at a FPlatformTime::Seconds() time.
+	*/
+		 static bool PXR_GetEyeTrackingDataAtTime(double TimeSeconds, FPICOXREyeTrackingData& EyeTrackingData);
+
 	 //UFUNCTION(BlueprintCallable, Category = "PXR|PXRHMD")
 		 static bool PXR_EnableEyeTracking(bool enable);
 
@@ -61,3 +61,55 @@ private:
 	FShaderParameter InFaceIndexParameter;
 #endif
 };
+
+/**
+* Splits a single MRC scene capture (scene color with scene depth in alpha) into the background and foreground layers.
+*/
+class FPICOMRCSplitPS : public FGlobalShader
+{
+	DECLARE_EXPORTED_SHADER_TYPE(FPICOMRCSplitPS, Global, PICOXRHMD_API);
+public:
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters) { return true; }
+
+	FPICOMRCSplitPS(const ShaderMetaType::CompiledShaderInitializerType& Initializer) :
+		FGlobalShader(Initializer)
+	{
+		InTexture.Bind(Initializer.ParameterMap, TEXT("InTexture"), SPF_Mandatory);
+		InTextureSampler.Bind(Initializer.ParameterMap, TEXT("InTextureSampler"));
+		PlayerPlaneParameter.Bind(Initializer.ParameterMap, TEXT("PlayerPlane"));
+		InvProjectionScaleParameter.Bind(Initializer.ParameterMap, TEXT("InvProjectionScale"));
+	}
+	FPICOMRCSplitPS() {}
+
+	/** PlayerPlane is in view space (x right, y up, z forward) with the distance from the camera in W */
+	void SetParameters(FRHICommandList& RHICmdList, FRHISamplerState* SamplerStateRHI, FRHITexture* TextureRHI, const FVector4& PlayerPlane, const FVector2D& InvProjectionScale)
+	{
+#if ENGINE_MAJOR_VERSION >=5
+		SetTextureParameter(RHICmdList, RHICmdList.GetBoundPixelShader(), InTexture, InTextureSampler, SamplerStateRHI, TextureRHI);
+		SetShaderValue(RHICmdList, RHICmdList.GetBoundPixelShader(), PlayerPlaneParameter, FVector4f(PlayerPlane));
+		SetShaderValue(RHICmdList, RHICmdList.GetBoundPixelShader(), InvProjectionScaleParameter, FVector2f(InvProjectionScale));
+#elif ENGINE_MINOR_VERSION >=25
+		SetTextureParameter(RHICmdList, RHICmdList.GetBoundPixelShader(), InTexture, InTextureSampler, SamplerStateRHI, TextureRHI);
+		SetShaderValue(RHICmdList, RHICmdList.GetBoundPixelShader(), PlayerPlaneParameter, PlayerPlane);
+		SetShaderValue(RHICmdList, RHICmdList.GetBoundPixelShader(), InvProjectionScaleParameter, InvProjectionScale);
+#else
+		SetTextureParameter(RHICmdList, GetPixelShader(), InTexture, InTextureSampler, SamplerStateRHI, TextureRHI);
+		SetShaderValue(RHICmdList, GetPixelShader(), PlayerPlaneParameter, PlayerPlane);
+		SetShaderValue(RHICmdList, GetPixelShader(), InvProjectionScaleParameter, InvProjectionScale);
+#endif
+	}
+
+private:
+#if ENGINE_MAJOR_VERSION >=5 || ENGINE_MINOR_VERSION >=25
+	LAYOUT_FIELD(FShaderResourceParameter, InTexture);
+	LAYOUT_FIELD(FShaderResourceParameter, InTextureSampler);
+	LAYOUT_FIELD(FShaderParameter, PlayerPlaneParameter);
+	LAYOUT_FIELD(FShaderParameter, InvProjectionScaleParameter);
+#else
+	FShaderResourceParameter InTexture;
+	FShaderResourceParameter InTextureSampler;
+	FShaderParameter PlayerPlaneParameter;
+	FShaderParameter InvProjectionScaleParameter;
+#endif
+};
@@ -42,6 +42,8 @@ void UPICOXRHandComponent::BeginPlay()
 	{
 		bCustomHandMesh = true;
 	}
+	// The tracker is registered with the input device, resolve it once rather than enumerating the modular features every tick
+	HandTracker = GetHandTracker();
 	//Hide Component if HandTracking is Disabled
 	const bool bStartHidden = UPICOXRInputFunctionLibrary::IsHandTrackingEnabled() ? false : true;
 	SetHiddenInGame(bStartHidden, true);
@@ -68,8 +70,9 @@ void UPICOXRHandComponent::TickComponent(float DeltaTime, enum ELevelTick TickTy
 
 		if (SkeletalMesh)
 		{
-			UpdateBonePose();
-			UpdateHandTransform();
+			const FTransform HandRootPose = UPICOXRInputFunctionLibrary::GetHandRootPose(SkeletonType);
+			UpdateBonePose(HandRootPose);
+			UpdateHandTransform(HandRootPose);
 		}
 	}
 	else
@@ -83,34 +86,68 @@ void UPICOXRHandComponent::TickComponent(float DeltaTime, enum ELevelTick TickTy
 	}
 }
 
-void UPICOXRHandComponent::UpdateBonePose()
+void UPICOXRHandComponent::SetSkeletalMesh(USkeletalMesh* NewMesh, bool bReinitPose)
+{
+	Super::SetSkeletalMesh(NewMesh, bReinitPose);
+	bJointBoneTableDirty = true;
+}
+
+void UPICOXRHandComponent::RefreshBoneMapping()
+{
+	bJointBoneTableDirty = true;
+}
+
+void UPICOXRHandComponent::BuildJointBoneTable()
+{
+	JointBoneTable.Reset();
+	JointBoneTableMesh = SkeletalMesh;
+	bJointBoneTableDirty = false;
+	if (!SkeletalMesh)
+	{
+		return;
+	}
+
+#if ENGINE_MINOR_VERSION >26
+	const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+#else
+	const FReferenceSkeleton& RefSkeleton = SkeletalMesh->RefSkeleton;
+#endif
+	for (const TPair<EPICOXRHandJoint, FName>& BoneElem : BoneNameMappings)
+	{
+		const int32 BoneIndex = BoneElem.Value.IsNone() ? INDEX_NONE : RefSkeleton.FindBoneIndex(BoneElem.Value);
+		if (BoneIndex != INDEX_NONE)
+		{
+			JointBoneTable.Add({ BoneElem.Key, BoneIndex, BoneElem.Value });
+		}
+	}
+	// Parents before children, the wrist is set in world space and depends on its parents' pose
+	JointBoneTable.Sort([](const FJointBone& A, const FJointBone& B) { return A.Joint < B.Joint; });
+}
+
+void UPICOXRHandComponent::UpdateBonePose(const FTransform& HandRootPose)
 {
 	if (bCustomHandMesh)
 	{
-		for (auto& BoneElem : BoneNameMappings)
+		if (bJointBoneTableDirty || JointBoneTableMesh != SkeletalMesh)
 		{
-			if (BoneElem.Key == EPICOXRHandJoint::Wrist)
+			BuildJointBoneTable();
+		}
+
+		for (const FJointBone& JointBone : JointBoneTable)
+		{
+			if (JointBone.Joint == EPICOXRHandJoint::Wrist)
 			{
-				FTransform BoneTransform = UPICOXRInputFunctionLibrary::GetHandRootPose(SkeletonType);
-				if (!BoneTransform.Rotator().ContainsNaN() && !BoneTransform.Rotator().IsZero())
+				if (!HandRootPose.Rotator().ContainsNaN() && !HandRootPose.Rotator().IsZero())
 				{
-					SetBoneRotationByName(BoneElem.Value, BoneTransform.Rotator(), EBoneSpaces::WorldSpace);
+					SetBoneRotationByName(JointBone.BoneName, HandRootPose.Rotator(), EBoneSpaces::WorldSpace);
 				}
 			}
-			else
+			else if (HandTracker && BoneSpaceTransforms.IsValidIndex(JointBone.BoneIndex))
 			{
-#if ENGINE_MINOR_VERSION >26
- 				const int32 BoneIndex = SkeletalMesh->GetRefSkeleton().FindBoneIndex(BoneElem.Value);
-#else
-				const int32 BoneIndex = SkeletalMesh->RefSkeleton.FindBoneIndex(BoneElem.Value);
-#endif
-				if (BoneIndex >= 0)
+				FQuat BoneRotation = HandTracker->GetBoneRotation(SkeletonType, JointBone.Joint);
+				if (!BoneRotation.IsIdentity())
 				{
-					FQuat BoneRotation = UPICOXRInputFunctionLibrary::GetBoneRotation(SkeletonType, BoneElem.Key);
-					if (!BoneRotation.IsIdentity())
-					{
-						BoneSpaceTransforms[BoneIndex].SetRotation(BoneRotation);
-					}
+					BoneSpaceTransforms[JointBone.BoneIndex].SetRotation(BoneRotation);
 				}
 			}
 		}
@@ -119,9 +156,8 @@ void UPICOXRHandComponent::UpdateBonePose()
 	MarkRefreshTransformDirty();
 }
 
-void UPICOXRHandComponent::UpdateHandTransform()
+void UPICOXRHandComponent::UpdateHandTransform(const FTransform& HandPose)
 {
-	const FTransform HandPose = UPICOXRInputFunctionLibrary::GetHandRootPose(SkeletonType);
 	if (HandPose.IsValid() && !HandPose.Equals(FTransform()))
 	{
 		if (!HandPose.GetLocation().ContainsNaN())
@@ -6,6 +6,7 @@
 #include "PXR_HandComponent.generated.h"
 
 class APlayerCameraManager;
+class IPXR_HandTracker;
 
 UCLASS(Blueprintable, ClassGroup = (PICOXRComponent), meta = (BlueprintSpawnableComponent))
 class PICOXRINPUT_API UPICOXRHandComponent : public UPoseableMeshComponent
@@ -19,6 +20,8 @@ public:
 
  	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	virtual void SetSkeletalMesh(USkeletalMesh* NewMesh, bool bReinitPose = true) override;
+
  	/** Behavior for when hand tracking loses high confidence tracking */
  	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "HandProperties")
  	bool bHideByConfidence;
@@ -31,10 +34,29 @@ public:
  	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "CustomSkeletalMesh")
  	TMap<EPICOXRHandJoint, FName> BoneNameMappings;
 
+	/** Rebuilds the joint to bone lookup, call after changing BoneNameMappings at runtime */
+	UFUNCTION(BlueprintCallable, Category = "CustomSkeletalMesh")
+	void RefreshBoneMapping();
+
  private:
  	/** Whether or not a custom hand mesh is being used */
  	bool bCustomHandMesh = false;
-	
- 	void UpdateBonePose();
- 	void UpdateHandTransform();
+
+	struct FJointBone
+	{
+		EPICOXRHandJoint Joint;
+		int32 BoneIndex;
+		FName BoneName;
+	};
+	/** Mapped joints resolved against the mesh's reference skeleton, in joint order */
+	TArray<FJointBone> JointBoneTable;
+	/** Only compared against SkeletalMesh, never dereferenced */
+	const USkeletalMesh* JointBoneTableMesh = nullptr;
+	bool bJointBoneTableDirty = true;
+	/** Resolved in BeginPlay, the wrist is posed without it */
+	IPXR_HandTracker* HandTracker = nullptr;
+
+	void BuildJointBoneTable();
+ 	void UpdateBonePose(const FTransform& HandRootPose);
+ 	void UpdateHandTransform(const FTransform& HandPose);
 };
@@ -21,6 +21,10 @@
 #endif
 #define LOCTEXT_NAMESPACE "PICOXRInput"
 
+DECLARE_STATS_GROUP(TEXT("PICOXRInput"), STATGROUP_PICOXRInput, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Controller Tracking Snapshot Hits"), STAT_PICOXRControllerTrackingSnapshotHits, STATGROUP_PICOXRInput);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Controller Tracking Snapshot Misses"), STAT_PICOXRControllerTrackingSnapshotMisses, STATGROUP_PICOXRInput);
+
 FVector FPICOXRInput::OriginOffsetL = FVector::ZeroVector;
 FVector FPICOXRInput::OriginOffsetR = FVector::ZeroVector;
 
@@ -83,6 +87,7 @@ void FPICOXRInput::SendControllerEvents()
 	}
 	ProcessButtonEvent();
 	ProcessButtonAxis();
+	CaptureControllerTracking_GameThread();
 #endif
 	UpdateHandState();
 }
@@ -574,13 +579,13 @@ bool FPICOXRInput::GetPredictedLocationAndRotation(EControllerHand DeviceHand, f
 	{
 		return false;
 	}
-	if (LeftConnectState && DeviceHand == EControllerHand::Left)
-	{
-		GetControllerSensorData(DeviceHand, WorldToMetersScale, PredictedTime, SourcePosition, SourceOrientation, PredictedRotation, PredictedLocation);
-	}
-	else if (RightConnectState && DeviceHand == EControllerHand::Right)
+	// The caller picks the predicted time, sample it on its own so the frame's snapshot stays what every other query
+	// of this frame reads
+	if ((LeftConnectState && DeviceHand == EControllerHand::Left) || (RightConnectState && DeviceHand == EControllerHand::Right))
 	{
-		GetControllerSensorData(DeviceHand, WorldToMetersScale, PredictedTime, SourcePosition, SourceOrientation, PredictedRotation, PredictedLocation);
+		FPICOXRControllerTrackingSnapshot Snapshot;
+		SampleControllerTracking(DeviceHand, PredictedTime, SourcePosition, SourceOrientation, Snapshot);
+		ConvertControllerTracking(DeviceHand, Snapshot, WorldToMetersScale, PredictedRotation, PredictedLocation);
 	}
 	OutPosition = PredictedLocation;
 	OutOrientation = PredictedRotation;
@@ -1177,29 +1182,72 @@ void FPICOXRInput::UpdateConnectState()
 	PXR_LOGD(PxrUnreal, "FPICOXRInput::UpdateConnectState ControllerType  %d, LeftConnectState %d, RightConnectState %d", ControllerType, LeftConnectState, RightConnectState);
 }
 
-void FPICOXRInput::GetControllerSensorData(EControllerHand DeviceHand, float WorldToMetersScale, double inPredictedTime, FVector SourcePosition, FQuat SourceOrientation, FRotator& OutOrientation, FVector& OutPosition) const
+void FPICOXRInput::CaptureControllerTracking_GameThread()
+{
+	check(IsInGameThread());
+	// Right after WaitFrame, so every game thread query of this frame reads the same pose
+	FPXRGameFrame* CurrentFrame = PICOXRHMD ? PICOXRHMD->NextGameFrameToRender_GameThread.Get() : nullptr;
+	if (!CurrentFrame)
+	{
+		return;
+	}
+	if (LeftConnectState)
+	{
+		GetControllerTrackingSnapshot(EControllerHand::Left, CurrentFrame->predictedDisplayTimeMs, CurrentFrame->Position, CurrentFrame->Orientation);
+	}
+	if (RightConnectState && ControllerType != G2)
+	{
+		GetControllerTrackingSnapshot(EControllerHand::Right, CurrentFrame->predictedDisplayTimeMs, CurrentFrame->Position, CurrentFrame->Orientation);
+	}
+}
+
+const FPICOXRControllerTrackingSnapshot& FPICOXRInput::GetControllerTrackingSnapshot(EControllerHand DeviceHand, double PredictedTimeMs, const FVector& SourcePosition, const FQuat& SourceOrientation) const
 {
+	const int32 HandIndex = DeviceHand == EControllerHand::Left ? EPICOXRControllerHandness::LeftController : EPICOXRControllerHandness::RightController;
+	FPICOXRControllerTrackingSnapshot& Snapshot = TrackingSnapshots[IsInRenderingThread() ? 1 : 0][HandIndex];
+	if (Snapshot.bValid && Snapshot.PredictedTimeMs == PredictedTimeMs && Snapshot.HeadPosition == SourcePosition && Snapshot.HeadOrientation == SourceOrientation)
+	{
+		INC_DWORD_STAT(STAT_PICOXRControllerTrackingSnapshotHits);
+		return Snapshot;
+	}
+	INC_DWORD_STAT(STAT_PICOXRControllerTrackingSnapshotMisses);
+	SampleControllerTracking(DeviceHand, PredictedTimeMs, SourcePosition, SourceOrientation, Snapshot);
+	return Snapshot;
+}
+
+void FPICOXRInput::SampleControllerTracking(EControllerHand DeviceHand, double PredictedTimeMs, const FVector& SourcePosition, const FQuat& SourceOrientation, FPICOXRControllerTrackingSnapshot& OutSnapshot) const
+{
+	OutSnapshot.PredictedTimeMs = PredictedTimeMs;
+	OutSnapshot.HeadPosition = SourcePosition;
+	OutSnapshot.HeadOrientation = SourceOrientation;
 #if PLATFORM_ANDROID
-	FQuat Orientation;
+	const int32 HandIndex = DeviceHand == EControllerHand::Left ? EPICOXRControllerHandness::LeftController : EPICOXRControllerHandness::RightController;
 	float HeadSensorData[7] = {SourceOrientation.X, SourceOrientation.Y, SourceOrientation.Z, SourceOrientation.W, SourcePosition.X, SourcePosition.Y, SourcePosition.Z};
-
 	PxrControllerTracking tracking;
-    uint32_t hand;
-
-    if (DeviceHand == EControllerHand::Left) {
-        hand = EPICOXRControllerHandness::LeftController;
-    } else {
-        hand = EPICOXRControllerHandness::RightController;
-    }
-	Pxr_GetControllerTrackingState(hand, inPredictedTime, HeadSensorData, &tracking);
-	
-	Orientation.X = tracking.localControllerPose.pose.orientation.x;
-	Orientation.Y = tracking.localControllerPose.pose.orientation.y;
-	Orientation.Z = tracking.localControllerPose.pose.orientation.z;
-	Orientation.W = tracking.localControllerPose.pose.orientation.w;
-	OutPosition.X = tracking.localControllerPose.pose.position.x;
-	OutPosition.Y = tracking.localControllerPose.pose.position.y;
-	OutPosition.Z = tracking.localControllerPose.pose.position.z;
+	Pxr_GetControllerTrackingState(HandIndex, PredictedTimeMs, HeadSensorData, &tracking);
+
+	OutSnapshot.Orientation.X = tracking.localControllerPose.pose.orientation.x;
+	OutSnapshot.Orientation.Y = tracking.localControllerPose.pose.orientation.y;
+	OutSnapshot.Orientation.Z = tracking.localControllerPose.pose.orientation.z;
+	OutSnapshot.Orientation.W = tracking.localControllerPose.pose.orientation.w;
+	OutSnapshot.Position.X = tracking.localControllerPose.pose.position.x;
+	OutSnapshot.Position.Y = tracking.localControllerPose.pose.position.y;
+	OutSnapshot.Position.Z = tracking.localControllerPose.pose.position.z;
+#endif
+	OutSnapshot.bValid = true;
+}
+
+void FPICOXRInput::GetControllerSensorData(EControllerHand DeviceHand, float WorldToMetersScale, double inPredictedTime, FVector SourcePosition, FQuat SourceOrientation, FRotator& OutOrientation, FVector& OutPosition) const
+{
+	ConvertControllerTracking(DeviceHand, GetControllerTrackingSnapshot(DeviceHand, inPredictedTime, SourcePosition, SourceOrientation), WorldToMetersScale, OutOrientation, OutPosition);
+}
+
+void FPICOXRInput::ConvertControllerTracking(EControllerHand DeviceHand, const FPICOXRControllerTrackingSnapshot& Snapshot, float WorldToMetersScale, FRotator& OutOrientation, FVector& OutPosition) const
+{
+#if PLATFORM_ANDROID
+	const FVector& SourcePosition = Snapshot.HeadPosition;
+	FQuat Orientation = Snapshot.Orientation;
+	OutPosition = Snapshot.Position;
 
 	OutPosition = FVector(-OutPosition.Z * WorldToMetersScale, OutPosition.X * WorldToMetersScale, OutPosition.Y * WorldToMetersScale);
 	Orientation = FQuat(-Orientation.Z, Orientation.X, Orientation.Y, -Orientation.W);
@@ -93,6 +93,30 @@ static const FQuat RightRootFixupOrientation3 = FQuat(0.0f,0.0f,FMath::Sin(-PI /
 class FPICOXRHMD;
 class UPICOXRHandComponent;
 
+/** The PICO hand tracker registered as a modular feature, null if there is none */
+IPXR_HandTracker* GetHandTracker();
+
+/** Raw runtime-space controller pose, captured once per hand and per frame/late update */
+struct FPICOXRControllerTrackingSnapshot
+{
+	bool bValid;
+	double PredictedTimeMs;
+	FVector HeadPosition;
+	FQuat HeadOrientation;
+	FVector Position;
+	FQuat Orientation;
+
+	FPICOXRControllerTrackingSnapshot()
+		: bValid(false)
+		, PredictedTimeMs(0)
+		, HeadPosition(FVector::ZeroVector)
+		, HeadOrientation(FQuat::Identity)
+		, Position(FVector::ZeroVector)
+		, Orientation(FQuat::Identity)
+	{
+	}
+};
+
 class FPICOXRInput : public IInputDevice, public IPXR_HandTracker, public FXRMotionControllerBase, public IHapticDevice, public TSharedFromThis<FPICOXRInput>
 {
 public:
@@ -177,6 +201,11 @@ private:
 	void ProcessButtonAxis();
 	void UpdateConnectState();
 	void GetControllerSensorData(EControllerHand DeviceHand, float WorldToMetersScale, double inPredictedTime, FVector SourcePosition, FQuat SourceOrientation, FRotator& OutOrientation, FVector& OutPosition) const;
+	const FPICOXRControllerTrackingSnapshot& GetControllerTrackingSnapshot(EControllerHand DeviceHand, double PredictedTimeMs, const FVector& SourcePosition, const FQuat& SourceOrientation) const;
+	/** Reads the pose from the runtime without touching the per-frame snapshots, for queries at a caller-chosen time */
+	void SampleControllerTracking(EControllerHand DeviceHand, double PredictedTimeMs, const FVector& SourcePosition, const FQuat& SourceOrientation, FPICOXRControllerTrackingSnapshot& OutSnapshot) const;
+	void ConvertControllerTracking(EControllerHand DeviceHand, const FPICOXRControllerTrackingSnapshot& Snapshot, float WorldToMetersScale, FRotator& OutOrientation, FVector& OutPosition) const;
+	void CaptureControllerTracking_GameThread();
 
 	FPICOXRHMD* PICOXRHMD;
 	TSharedRef<FGenericApplicationMessageHandler> MessageHandler;
@@ -202,4 +231,7 @@ private:
 	EPICOInputType ControllerType;
 	UPICOXRSettings* Settings;
 	int CurrentVersion;
+	// [0] game thread, [1] render thread. A snapshot is reused while the predicted time and head pose it was taken with
+	// are unchanged, so late update (which moves the head pose) gets a fresh one.
+	mutable FPICOXRControllerTrackingSnapshot TrackingSnapshots[2][(int32)EPICOXRControllerHandness::ControllerCount];
 };
@@ -16,7 +16,8 @@ public class PICOXRMRC : ModuleRules
                     "InputDevice",			// For IInputDevice.h
 					"HeadMountedDisplay",	// For IMotionController.h
 					"ImageWrapper",
-                    "Engine"
+                    "Engine",
+                    "Renderer"
                 });
 
         PrivateDependencyModuleNames.AddRange(
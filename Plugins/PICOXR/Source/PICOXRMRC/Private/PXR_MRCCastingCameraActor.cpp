@@ -17,6 +17,13 @@
 #include "Runtime/Engine/Classes/Camera/CameraComponent.h"
 #include "XRThreadUtils.h"
 #include "UObject/ConstructorHelpers.h"
+#include "HAL/IConsoleManager.h"
+#include "Modules/ModuleManager.h"
+#include "RendererInterface.h"
+#include "ScreenRendering.h"
+#include "PipelineStateCache.h"
+#include "CommonRenderResources.h"
+#include "PXR_Shaders.h"
 
 #if PICO_MRC_SUPPORTED_PLATFORMS
 #include "Android/AndroidApplication.h"
@@ -24,13 +31,37 @@
 #include "PxrApi.h"
 #endif
 
+// Before 4.26 the captures use FinalColorLDR, which carries no scene depth to split on
+#define PICO_MRC_SINGLE_PASS_CAPTURE (ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26)
+
+static TAutoConsoleVariable<int32> CVarPICOMRCSinglePassCapture(
+	TEXT("vr.PICO.MRC.SinglePassCapture"),
+	1,
+	TEXT("1 renders the MRC background and foreground layers from one scene capture split on the player plane, 0 alternates two scene captures between them."),
+	ECVF_Default);
+
+static bool WantsSinglePassCapture(bool bEnableForeground)
+{
+	return PICO_MRC_SINGLE_PASS_CAPTURE && bEnableForeground && CVarPICOMRCSinglePassCapture.GetValueOnGameThread() != 0;
+}
+
+DECLARE_STATS_GROUP(TEXT("PICOXRMRC"), STATGROUP_PICOXRMRC, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Captures"), STAT_PICOXRMRCSceneCaptures, STATGROUP_PICOXRMRC);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Layers Updated"), STAT_PICOXRMRCLayersUpdated, STATGROUP_PICOXRMRC);
+DECLARE_CYCLE_STAT(TEXT("Single-Pass Capture (Render Thread)"), STAT_PICOXRMRCSinglePassCapture, STATGROUP_PICOXRMRC);
+
 APICOXRMRC_CastingCameraActor::APICOXRMRC_CastingCameraActor(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer)
 	,BackgroundRenderTarget(nullptr)
 	,ForegroundRenderTarget(nullptr)
 	,bEnableForeground(true)
 	,ForegroundMaxDistance(300.f)
+	,SceneCaptureRenderTarget(nullptr)
 	,bHasInitializedInGameCamOnce(false)
+	,bSinglePassCapture(false)
+	,ProjectionFOV(0.f)
+	,ProjectionYMultiplier(0.f)
+	,ForegroundProjectionFarClip(0.f)
 	,MRState(nullptr)
 	,M_MRC(nullptr)
 	,MI_Background(nullptr)
@@ -79,6 +110,16 @@ void APICOXRMRC_CastingCameraActor::Tick(float DeltaTime)
 		SetMRCTrackingReference();
 		UpdateInGameCamPose();
 		UpdateCamMatrixAndDepth();
+
+		if (WantsSinglePassCapture(bEnableForeground) != bSinglePassCapture)
+		{
+			SetSinglePassCapture(!bSinglePassCapture);
+		}
+		if (bSinglePassCapture)
+		{
+			CaptureSinglePass();
+			return;
+		}
 			
 		if (bEnableForeground&&!ForegroundCaptureActor)
 		{
@@ -111,6 +152,8 @@ void APICOXRMRC_CastingCameraActor::Tick(float DeltaTime)
 			GetCaptureComponent2D()->SetVisibility(true);
 		}
 
+		INC_DWORD_STAT(STAT_PICOXRMRCSceneCaptures);
+		INC_DWORD_STAT(STAT_PICOXRMRCLayersUpdated);
 	}
 }
 
@@ -139,6 +182,7 @@ void APICOXRMRC_CastingCameraActor::SpawnForegroundCaptureActor()
 		float y = MRState->TrackedCamera.Height;
 		ForegroundCaptureActor->GetCaptureComponent2D()->FOVAngle = MRState->TrackedCamera.FOV * (x / y);
 		ForegroundCaptureActor->AttachToActor(this, FAttachmentTransformRules(EAttachmentRule::SnapToTarget, true));
+		ForegroundProjectionFarClip = 0.f;
 		PXR_LOGI(LogMRC, "Spawn Forground MRC Capture Actor Over!");
 	}
 }
@@ -157,6 +201,118 @@ void APICOXRMRC_CastingCameraActor::DestroyForeroundCaptureActor()
 	}
 }
 
+void APICOXRMRC_CastingCameraActor::SetSinglePassCapture(bool bEnable)
+{
+	PXR_LOGI(LogMRC, "Single-pass MRC capture:%d", bEnable);
+	bSinglePassCapture = bEnable;
+	USceneCaptureComponent2D* CaptureComponent = GetCaptureComponent2D();
+	if (bEnable)
+	{
+		DestroyForeroundCaptureActor();
+		if (!SceneCaptureRenderTarget)
+		{
+			const FName TargetName = MakeUniqueObjectName(this, UTextureRenderTarget2D::StaticClass(), TEXT("MRCSceneCaptureTarget"));
+			SceneCaptureRenderTarget = NewObject<UTextureRenderTarget2D>(this, TargetName);
+			SceneCaptureRenderTarget->InitCustomFormat(MRState->TrackedCamera.Width, MRState->TrackedCamera.Height, PF_FloatRGBA, true);
+		}
+		// Depth goes to alpha, and CaptureSinglePass splits each capture right after it is queued
+		CaptureComponent->CaptureSource = ESceneCaptureSource::SCS_SceneColorSceneDepth;
+		CaptureComponent->TextureTarget = SceneCaptureRenderTarget;
+		CaptureComponent->bCaptureEveryFrame = false;
+		CaptureComponent->SetVisibility(true);
+	}
+	else
+	{
+		CaptureComponent->CaptureSource = ESceneCaptureSource::SCS_SceneColorHDR;
+		CaptureComponent->TextureTarget = BackgroundRenderTarget;
+		CaptureComponent->bCaptureEveryFrame = true;
+		if (!bEnableForeground && ForegroundRenderTarget)
+		{
+			UKismetRenderingLibrary::ClearRenderTarget2D(this, ForegroundRenderTarget, FLinearColor::Green);
+		}
+	}
+}
+
+#if PICO_MRC_SINGLE_PASS_CAPTURE
+// Render thread only
+static uint32 GPICOXRMRCCaptureStartCycles = 0;
+
+static void SplitSceneCapture_RenderThread(FRHICommandListImmediate& RHICmdList, FRHITexture* SceneCaptureTexture, FRHITexture* BackgroundTexture, FRHITexture* ForegroundTexture, const FVector4& PlayerPlane, const FVector2D& InvProjectionScale)
+{
+	static const FName RendererModuleName("Renderer");
+	IRendererModule* RendererModule = FModuleManager::GetModulePtr<IRendererModule>(RendererModuleName);
+	if (!RendererModule || !SceneCaptureTexture || !BackgroundTexture || !ForegroundTexture)
+	{
+		return;
+	}
+
+	const FIntPoint TargetSize(BackgroundTexture->GetSizeXYZ().X, BackgroundTexture->GetSizeXYZ().Y);
+	FRHITexture* ColorTargets[2] = { BackgroundTexture, ForegroundTexture };
+	FRHIRenderPassInfo RPInfo(2, ColorTargets, ERenderTargetActions::DontLoad_Store);
+	RHICmdList.BeginRenderPass(RPInfo, TEXT("PICOXRMRCSplitCapture"));
+	{
+		FGraphicsPipelineStateInitializer GraphicsPSOInit;
+		RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+		GraphicsPSOInit.BlendState = TStaticBlendState<>::GetRHI();
+		GraphicsPSOInit.RasterizerState = TStaticRasterizerState<>::GetRHI();
+		GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_Always>::GetRHI();
+		GraphicsPSOInit.PrimitiveType = PT_TriangleList;
+
+		auto ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+		TShaderMapRef<FScreenVS> VertexShader(ShaderMap);
+		TShaderMapRef<FPICOMRCSplitPS> PixelShader(ShaderMap);
+		GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GFilterVertexDeclaration.VertexDeclarationRHI;
+		GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+		GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
+		SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
+		PixelShader->SetParameters(RHICmdList, TStaticSamplerState<SF_Point>::GetRHI(), SceneCaptureTexture, PlayerPlane, InvProjectionScale);
+
+		RHICmdList.SetViewport(0, 0, 0.0f, TargetSize.X, TargetSize.Y, 1.0f);
+		RendererModule->DrawRectangle(
+			RHICmdList,
+			0, 0, TargetSize.X, TargetSize.Y,
+			0, 0, 1, 1,
+			TargetSize,
+			FIntPoint(1, 1),
+			VertexShader,
+			EDRF_Default);
+	}
+	RHICmdList.EndRenderPass();
+}
+#endif
+
+void APICOXRMRC_CastingCameraActor::CaptureSinglePass()
+{
+#if PICO_MRC_SINGLE_PASS_CAPTURE
+	USceneCaptureComponent2D* CaptureComponent = GetCaptureComponent2D();
+
+	// The player plane is vertical through the head, facing along the camera's horizontal forward; move it into view space
+	const FVector PlaneNormal = CaptureComponent->GetComponentTransform().InverseTransformVectorNoScale(GetActorForwardVector().GetSafeNormal2D());
+	const FVector4 PlayerPlane(PlaneNormal.Y, PlaneNormal.Z, PlaneNormal.X, ForegroundMaxDistance);
+	const FMatrix& ProjectionMatrix = CaptureComponent->CustomProjectionMatrix;
+	const FVector2D InvProjectionScale(1.0f / ProjectionMatrix.M[0][0], 1.0f / ProjectionMatrix.M[1][1]);
+
+	// Brackets the capture's render command so the stat covers the scene render and the split
+	ENQUEUE_RENDER_COMMAND(PICOXRMRCBeginSinglePassCapture)([](FRHICommandListImmediate& RHICmdList)
+	{
+		GPICOXRMRCCaptureStartCycles = FPlatformTime::Cycles();
+	});
+	CaptureComponent->CaptureScene();
+
+	FTextureRenderTargetResource* SceneCaptureResource = SceneCaptureRenderTarget->GameThread_GetRenderTargetResource();
+	FTextureRenderTargetResource* BackgroundResource = BackgroundRenderTarget->GameThread_GetRenderTargetResource();
+	FTextureRenderTargetResource* ForegroundResource = ForegroundRenderTarget->GameThread_GetRenderTargetResource();
+	ENQUEUE_RENDER_COMMAND(PICOXRMRCSplitCapture)([SceneCaptureResource, BackgroundResource, ForegroundResource, PlayerPlane, InvProjectionScale](FRHICommandListImmediate& RHICmdList)
+	{
+		SplitSceneCapture_RenderThread(RHICmdList, SceneCaptureResource->TextureRHI, BackgroundResource->GetRenderTargetTexture(), ForegroundResource->GetRenderTargetTexture(), PlayerPlane, InvProjectionScale);
+		SET_CYCLE_COUNTER(STAT_PICOXRMRCSinglePassCapture, FPlatformTime::Cycles() - GPICOXRMRCCaptureStartCycles);
+	});
+
+	INC_DWORD_STAT(STAT_PICOXRMRCSceneCaptures);
+	INC_DWORD_STAT_BY(STAT_PICOXRMRCLayersUpdated, 2);
+#endif
+}
+
 void APICOXRMRC_CastingCameraActor::SetMRCTrackingReference()
 {
 	if (MRState->CurrentTrackingReference)
@@ -203,7 +359,7 @@ void APICOXRMRC_CastingCameraActor::UpdateInGameCamPose()
 	bool UseCustomTrans = MRState->bUseCustomTrans;
 	if (UseCustomTrans)
 	{
-		RootComponent->SetRelativeTransform(MRState->CustomTrans);
+		SetCamRelativeTransform(MRState->CustomTrans);
 	}
 	else
 	{
@@ -227,7 +383,16 @@ void APICOXRMRC_CastingCameraActor::UpdateInGameCamPose()
 		PXR_LOGV(LogMRC, "In-Game ThirdCamera Final Relative Location:%s,Rotation:%s", PLATFORM_CHAR(*MRState->TrackedCamera.CalibratedOffset.ToString()), PLATFORM_CHAR(*MRState->TrackedCamera.CalibratedRotation.ToString()));
 		FTransform FinalTransform(MRState->TrackedCamera.CalibratedRotation, MRState->TrackedCamera.CalibratedOffset);
 		MRState->FinalTransform = FinalTransform;
-		RootComponent->SetRelativeTransform(MRState->FinalTransform);
+		SetCamRelativeTransform(MRState->FinalTransform);
+	}
+}
+
+void APICOXRMRC_CastingCameraActor::SetCamRelativeTransform(const FTransform& RelativeTransform)
+{
+	// A static calibration gives the same pose every tick, skip the transform update and its propagation to the captures
+	if (!RootComponent->GetRelativeTransform().Equals(RelativeTransform, KINDA_SMALL_NUMBER))
+	{
+		RootComponent->SetRelativeTransform(RelativeTransform);
 	}
 }
 
@@ -284,10 +449,17 @@ void APICOXRMRC_CastingCameraActor::UpdateCamMatrixAndDepth()
 
 	// Use custom projection matrix for far clip plane and to use camera aspect ratio instead of rendertarget aspect ratio
 	float YMultiplier = (float)CameraTargetSize.X / (float)CameraTargetSize.Y;
-	GetCaptureComponent2D()->bUseCustomProjectionMatrix = true;
-	MakeProjectionMatrix(YMultiplier, FOV, GNearClippingPlane, GetCaptureComponent2D()->CustomProjectionMatrix);
-	if (ForegroundCaptureActor)
+	const bool bProjectionChanged = FOV != ProjectionFOV || YMultiplier != ProjectionYMultiplier;
+	if (bProjectionChanged)
+	{
+		ProjectionFOV = FOV;
+		ProjectionYMultiplier = YMultiplier;
+		GetCaptureComponent2D()->bUseCustomProjectionMatrix = true;
+		MakeProjectionMatrix(YMultiplier, FOV, GNearClippingPlane, GetCaptureComponent2D()->CustomProjectionMatrix);
+	}
+	if (ForegroundCaptureActor && (bProjectionChanged || !FMath::IsNearlyEqual(ForegroundMaxDistance, ForegroundProjectionFarClip)))
 	{
+		ForegroundProjectionFarClip = ForegroundMaxDistance;
 		ForegroundCaptureActor->GetCaptureComponent2D()->bUseCustomProjectionMatrix = true;
 		MakeProjectionMatrix(YMultiplier, FOV, ForegroundMaxDistance, ForegroundCaptureActor->GetCaptureComponent2D()->CustomProjectionMatrix);
 	}
@@ -333,7 +505,10 @@ void APICOXRMRC_CastingCameraActor::InitializeInGameCam()
 		GetCaptureComponent2D()->FOVAngle = MRState->TrackedCamera.FOV * (x / y);
 		PXR_LOGI(LogMRC, "Final FOV:%f", GetCaptureComponent2D()->FOVAngle);
 	
-		SpawnForegroundCaptureActor();
+		if (!WantsSinglePassCapture(bEnableForeground))
+		{
+			SpawnForegroundCaptureActor();
+		}
 		if (FPICOXRMRCModule::IsAvailable()&& FPICOXRMRCModule::Get().GetPICOXRHMD())
 		{
 			FTextureRHIRef BG=nullptr, FG=nullptr;
@@ -39,6 +39,10 @@ public:
 	UPROPERTY()
 	UTextureRenderTarget2D* ForegroundRenderTarget;
 
+	/** Scene color and depth of the single-pass capture, split into the background and foreground targets every frame */
+	UPROPERTY()
+	UTextureRenderTarget2D* SceneCaptureRenderTarget;
+
 	bool bEnableForeground;
 private:
 	
@@ -49,9 +53,18 @@ private:
 	void UpdateCamMatrixAndDepth();
 	void SpawnForegroundCaptureActor();
 	void DestroyForeroundCaptureActor();
+	void SetSinglePassCapture(bool bEnable);
+	void CaptureSinglePass();
+	void SetCamRelativeTransform(const FTransform& RelativeTransform);
 
 	float ForegroundMaxDistance;
 	bool bHasInitializedInGameCamOnce;
+	bool bSinglePassCapture;
+
+	// Inputs of the custom projection matrices, they are only rebuilt when one of these changes
+	float ProjectionFOV;
+	float ProjectionYMultiplier;
+	float ForegroundProjectionFarClip;
 
 private:
 	UPROPERTY()
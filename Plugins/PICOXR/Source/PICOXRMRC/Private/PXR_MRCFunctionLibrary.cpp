@@ -26,7 +26,7 @@ void UPICOXRMRCFunctionLibrary::SimulateEnableMRC(bool enable)
 {
 	if (FPICOXRMRCModule::IsAvailable())
 	{
-		FPICOXRMRCModule::Get().bSimulateEnableMRC=enable;
+		FPICOXRMRCModule::Get().SetSimulateEnableMRC(enable);
 	}
 }
 
@@ -25,6 +25,8 @@ FPICOXRHMD* FPICOXRMRCModule::PICOXRHMD = nullptr;
 FPICOXRMRCModule::FPICOXRMRCModule()
 	:bSimulateEnableMRC(false)
 	, InGameThirdCamState(nullptr)
+	, InGameThirdCam(nullptr)
+	, CurrentWorld(nullptr)
 	, WorldAddedDelegate()
 	, WorldDestroyedDelegate()
 	, WorldLoadDelegate()
@@ -151,6 +153,17 @@ bool FPICOXRMRCModule::GetMRCRT(UTextureRenderTarget2D*& Background_RT, UTexture
 	return false;
 }
 
+void FPICOXRMRCModule::SetSimulateEnableMRC(bool enable)
+{
+	bSimulateEnableMRC = enable;
+#if PLATFORM_ANDROID
+	if (CurrentWorld)
+	{
+		SwitchCaptureActive();
+	}
+#endif
+}
+
 void FPICOXRMRCModule::EnableForeground(bool enable)
 {
 	if (IsMrcActivated() && InGameThirdCam)
@@ -175,6 +188,13 @@ void FPICOXRMRCModule::InitMRC()
 	WorldAddedDelegate = GEngine->OnWorldAdded().AddRaw(this, &FPICOXRMRCModule::OnWorldCreated);
 	WorldDestroyedDelegate = GEngine->OnWorldDestroyed().AddRaw(this, &FPICOXRMRCModule::OnWorldDestroyed);
 	WorldLoadDelegate = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FPICOXRMRCModule::OnWorldCreated);
+#if PLATFORM_ANDROID
+	// The runtime reports MRC status changes as events, so nothing runs per tick while MRC is off
+	if (PICOXRHMD && !MRCStatusChangedDelegate.IsValid())
+	{
+		MRCStatusChangedDelegate = PICOXRHMD->MRCStatusChangedDelegate.AddRaw(this, &FPICOXRMRCModule::OnMRCStatusChanged);
+	}
+#endif
 }
 
 void FPICOXRMRCModule::OpenInGameCam()
@@ -233,9 +253,6 @@ void FPICOXRMRCModule::OnWorldCreated(UWorld* NewWorld)
 	PXR_LOGI(LogMRC, "OnWorldCreated Delegates!");
 	CurrentWorld = NewWorld;
 	SwitchCaptureActive();
-
-	PreWorldTickDelegate = FWorldDelegates::OnWorldPreActorTick.AddRaw(this, &FPICOXRMRCModule::OnWorldTick);
-
 #endif
 }
 
@@ -243,13 +260,11 @@ void FPICOXRMRCModule::OnWorldDestroyed(UWorld* NewWorld)
 {
 	CurrentWorld = nullptr;
 #if PLATFORM_ANDROID
-	bCpture2DActorActivated = false;
-	if (PreWorldTickDelegate.IsValid())
+	if (bCpture2DActorActivated)
 	{
-		FWorldDelegates::OnWorldPreActorTick.Remove(PreWorldTickDelegate);
-		PreWorldTickDelegate.Reset();
+		bCpture2DActorActivated = false;
+		OnMRCActivationChanged.Broadcast(false);
 	}
-
 #endif
 }
 
@@ -320,6 +335,7 @@ void FPICOXRMRCModule::SwitchCaptureActive()
 			PXR_LOGI(LogMRC, "Activating MRC Capture");
 			OpenInGameCam();
 			bCpture2DActorActivated = true;
+			OnMRCActivationChanged.Broadcast(true);
 		}
 	}
 	else
@@ -334,16 +350,18 @@ void FPICOXRMRCModule::SwitchCaptureActive()
 				PICOXRHMD->DestroyMRCLayer();
 			}
 			bCpture2DActorActivated = false;
+			OnMRCActivationChanged.Broadcast(false);
 		}
 
 	}
 
 }
 
-void FPICOXRMRCModule::OnWorldTick(UWorld* World, ELevelTick Tick, float Delta)
+void FPICOXRMRCModule::OnMRCStatusChanged(bool bEnabled)
 {
-	// Poll MRC activation state
-	if (CurrentWorld && World == CurrentWorld)
+	PXR_LOGI(LogMRC, "MRC status changed:%d", bEnabled);
+	// Without a world the next OnWorldCreated picks the state up
+	if (CurrentWorld)
 	{
 		SwitchCaptureActive();
 	}
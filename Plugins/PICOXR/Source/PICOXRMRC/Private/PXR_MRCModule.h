@@ -61,8 +61,14 @@ public:
 
 	void EnableForeground(bool enable);
 
+	void SetSimulateEnableMRC(bool enable);
+
 	bool bSimulateEnableMRC;
 
+	/** Broadcast on the game thread when the in-game capture is opened or closed */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnMRCActivationChanged, bool /*bActivated*/);
+	FOnMRCActivationChanged OnMRCActivationChanged;
+
 	UPXRInGameThirdCamState* GetMRCState();
 
 private:
@@ -89,10 +95,10 @@ private:
 #if PLATFORM_ANDROID
 	FDelegateHandle InitialWorldAddedDelegate;
 	FDelegateHandle InitialWorldLoadDelegate;
-	FDelegateHandle PreWorldTickDelegate;
+	FDelegateHandle MRCStatusChangedDelegate;
 
 	void SwitchCaptureActive();
-	void OnWorldTick(UWorld* World, ELevelTick Tick, float Delta);
+	void OnMRCStatusChanged(bool bEnabled);
 	void OnInitialWorldCreated(UWorld* NewWorld);
 #endif
 };
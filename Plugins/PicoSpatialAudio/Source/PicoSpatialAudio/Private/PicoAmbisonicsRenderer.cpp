@@ -1,4 +1,5 @@
 #include "PicoAmbisonicsRenderer.h"
+#include "PxrAudioSpatializerKernels.h"
 
 namespace Pxr_Audio
 {
@@ -273,16 +274,10 @@ namespace Pxr_Audio
 			// Sum InputAudio directly into the corresponding channels in OutputAudio.
 			if (InputChannelsCount != OutputChannelsCount)
 			{
-				int32 NumChannelsToCopy = FMath::Min(InputChannelsCount, OutputChannelsCount);
-				for (int32 FrameIndex = 0; FrameIndex < InputNumFrames; FrameIndex++)
-				{
-					for (int32 ChannelIndex = 0; ChannelIndex < NumChannelsToCopy; ChannelIndex++)
-					{
-						const int32 InputIndex = FrameIndex * InputChannelsCount + ChannelIndex;
-						const int32 OutputIndex = FrameIndex * OutputChannelsCount + ChannelIndex;
-						OutputPacketPico.AudioBuffer[OutputIndex] += InputPacketUnreal.AudioBuffer[InputIndex];
-					}
-				}
+				const int32 NumChannelsToCopy = FMath::Min(InputChannelsCount, OutputChannelsCount);
+				Kernels::MixInChannels(InputPacketUnreal.AudioBuffer.GetData(), InputChannelsCount,
+				                       OutputPacketPico.AudioBuffer.GetData(), OutputChannelsCount, InputNumFrames,
+				                       NumChannelsToCopy);
 			}
 			else
 			{
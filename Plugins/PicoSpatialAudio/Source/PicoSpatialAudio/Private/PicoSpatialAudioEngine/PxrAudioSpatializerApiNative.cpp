@@ -1,4 +1,5 @@
 #include "PxrAudioSpatializerApiNative.h"
+#include <thread>
 
 namespace Pxr_Audio
 {
@@ -14,12 +15,45 @@ namespace Pxr_Audio
 			size_t FramesPerBuffer,
 			size_t SampleRate)
 		{
-			return PxrAudioSpatializer_CreateContext(&Context, Mode, FramesPerBuffer, SampleRate);
+			PxrAudioSpatializer_Context* NewContext = nullptr;
+			const auto Result = PxrAudioSpatializer_CreateContext(&NewContext, Mode, FramesPerBuffer, SampleRate);
+			PendingContext = NewContext;
+			return Result;
 		}
 
 		PxrAudioSpatializer_Result APINative::InitializeContext()
 		{
-			return PxrAudioSpatializer_InitializeContext(Context);
+			const auto Result = PxrAudioSpatializer_InitializeContext(PendingContext);
+			if (Result == PASP_SUCCESS)
+			{
+				Context.store(PendingContext);
+				PendingContext = nullptr;
+			}
+			return Result;
+		}
+
+		int APINative::GetReaderSlotIndex()
+		{
+			//	Threads take slots round-robin on their first call; threads sharing a slot are still correct
+			static std::atomic<int> NextReaderSlot(0);
+			static thread_local const int ReaderSlot = NextReaderSlot.fetch_add(1, std::memory_order_relaxed) %
+				NumReaderSlots;
+			return ReaderSlot;
+		}
+
+		void APINative::WaitForReaders()
+		{
+			for (int Pass = 0; Pass < 2; ++Pass)
+			{
+				const unsigned int PreviousEpoch = ReaderEpoch.fetch_add(1) & 1;
+				for (FReaderSlot& ReaderSlot : ReaderSlots)
+				{
+					while (ReaderSlot.NumReaders[PreviousEpoch].load() != 0)
+					{
+						std::this_thread::yield();
+					}
+				}
+			}
 		}
 
 		PxrAudioSpatializer_Result APINative::SubmitMesh(
@@ -31,15 +65,12 @@ namespace Pxr_Audio
 			Material,
 			int* GeometryId)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SubmitMesh(Context, Vertices, VerticesCount, Indices, IndicesCount,
+				return PxrAudioSpatializer_SubmitMesh(CurrentContext, Vertices, VerticesCount, Indices, IndicesCount,
 				                                        Material,
 				                                        GeometryId);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SubmitMeshAndMaterialFactor(
@@ -52,28 +83,22 @@ namespace Pxr_Audio
 			float TransmissionFactor,
 			int* GeometryId)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SubmitMeshAndMaterialFactor(
-					Context, Vertices, VerticesCount, Indices, IndicesCount,
+				return PxrAudioSpatializer_SubmitMeshAndMaterialFactor(
+					CurrentContext, Vertices, VerticesCount, Indices, IndicesCount,
 					AbsorptionFactor, ScatteringFactor,
 					TransmissionFactor,
 					GeometryId);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::RemoveMesh(int GeometryId)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_RemoveMesh(Context, GeometryId);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_RemoveMesh(CurrentContext, GeometryId);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::GetAbsorptionFactor(
@@ -96,13 +121,10 @@ namespace Pxr_Audio
 
 		PxrAudioSpatializer_Result APINative::CommitScene()
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_CommitScene(Context);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_CommitScene(CurrentContext);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::AddSource(
@@ -111,13 +133,10 @@ namespace Pxr_Audio
 			int* SourceId,
 			bool bIsAsync)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_AddSource(Context, SourceMode, Position, SourceId, bIsAsync);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_AddSource(CurrentContext, SourceMode, Position, SourceId, bIsAsync);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::AddSourceWithOrientation(PxrAudioSpatializer_SourceMode Mode,
@@ -128,15 +147,12 @@ namespace Pxr_Audio
 		                                                               int* SourceId,
 		                                                               bool bIsAsync)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_AddSourceWithOrientation(Context, Mode, Position, Front, Up, Radius,
+				return PxrAudioSpatializer_AddSourceWithOrientation(CurrentContext, Mode, Position, Front, Up, Radius,
 				                                                      SourceId,
 				                                                      bIsAsync);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::AddSourceWithConfig(
@@ -144,13 +160,10 @@ namespace Pxr_Audio
 			int* SourceId,
 			bool bIsAsync)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_AddSourceWithConfig(Context, SourceConfig, SourceId, bIsAsync);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_AddSourceWithConfig(CurrentContext, SourceConfig, SourceId, bIsAsync);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetSourceAttenuationMode(int SourceId,
@@ -160,39 +173,30 @@ namespace Pxr_Audio
 		                                                               DistanceAttenuationCallback
 		                                                               IndirectDistanceAttenuationCallback)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetSourceAttenuationMode(Context, SourceId, Mode,
+				return PxrAudioSpatializer_SetSourceAttenuationMode(CurrentContext, SourceId, Mode,
 				                                                      DirectDistanceAttenuationCallback,
 				                                                      IndirectDistanceAttenuationCallback);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetSourceRange(
 			int SourceId, float RangeMin, float RangeMax)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetSourceRange(Context, SourceId, RangeMin, RangeMax);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetSourceRange(CurrentContext, SourceId, RangeMin, RangeMax);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::RemoveSource(
 			int SourceId)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_RemoveSource(Context, SourceId);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_RemoveSource(CurrentContext, SourceId);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SubmitSourceBuffer(
@@ -200,13 +204,10 @@ namespace Pxr_Audio
 			const float* InputBufferPtr,
 			size_t NumFrames)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SubmitSourceBuffer(Context, SourceId, InputBufferPtr, NumFrames);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SubmitSourceBuffer(CurrentContext, SourceId, InputBufferPtr, NumFrames);
+			});
 		}
 
 		PxrAudioSpatializer_Result
@@ -218,17 +219,14 @@ namespace Pxr_Audio
 			float Gain,
 			int ParentAmbisonicOrder)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SubmitAmbisonicChannelBuffer(
-					Context, AmbisonicChannelBuffer, Order, Degree,
+				return PxrAudioSpatializer_SubmitAmbisonicChannelBuffer(
+					CurrentContext, AmbisonicChannelBuffer, Order, Degree,
 					NormType,
 					Gain,
 					ParentAmbisonicOrder);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SubmitInterleavedAmbisonicBuffer(const float* AmbisonicBuffer,
@@ -237,42 +235,33 @@ namespace Pxr_Audio
 		                                                                       NormType,
 		                                                                       float Gain)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SubmitInterleavedAmbisonicBuffer(
-					Context, AmbisonicBuffer, AmbisonicOrder, NormType,
+				return PxrAudioSpatializer_SubmitInterleavedAmbisonicBuffer(
+					CurrentContext, AmbisonicBuffer, AmbisonicOrder, NormType,
 					Gain);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SubmitMatrixInputBuffer(
 			const float* InputBuffer,
 			int InputChannelIndex)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SubmitMatrixInputBuffer(Context, InputBuffer, InputChannelIndex);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SubmitMatrixInputBuffer(CurrentContext, InputBuffer, InputChannelIndex);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::GetInterleavedBinauralBuffer(float* OutputBufferPtr,
 		                                                                   size_t NumFrames,
 		                                                                   bool bIsAccumulative)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_GetInterleavedBinauralBuffer(
-					Context, OutputBufferPtr, NumFrames, bIsAccumulative);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_GetInterleavedBinauralBuffer(
+					CurrentContext, OutputBufferPtr, NumFrames, bIsAccumulative);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::GetPlanarBinauralBuffer(
@@ -280,204 +269,161 @@ namespace Pxr_Audio
 			size_t NumFrames,
 			bool bIsAccumulative)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_GetPlanarBinauralBuffer(Context, OutputBufferPtr, NumFrames,
+				return PxrAudioSpatializer_GetPlanarBinauralBuffer(CurrentContext, OutputBufferPtr, NumFrames,
 				                                                     bIsAccumulative);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::GetInterleavedLoudspeakersBuffer(
 			float* OutputBufferPtr, size_t NumFrames)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_GetInterleavedLoudspeakersBuffer(Context, OutputBufferPtr, NumFrames);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_GetInterleavedLoudspeakersBuffer(CurrentContext, OutputBufferPtr, NumFrames);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::GetPlanarLoudspeakersBuffer(
 			float* const* OutputBufferPtr,
 			size_t NumFrames)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_GetPlanarLoudspeakersBuffer(Context, OutputBufferPtr, NumFrames);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_GetPlanarLoudspeakersBuffer(CurrentContext, OutputBufferPtr, NumFrames);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::UpdateScene()
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_UpdateScene(Context);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_UpdateScene(CurrentContext);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetDopplerEffect(int SourceId, int On)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetDopplerEffect(Context, SourceId, On);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetDopplerEffect(CurrentContext, SourceId, On);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetPlaybackMode(
 			PxrAudioSpatializer_PlaybackMode PlaybackMode)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetPlaybackMode(Context, PlaybackMode);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetPlaybackMode(CurrentContext, PlaybackMode);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetLoudspeakerArray(
 			const float* Positions,
 			int NumLoudspeakers)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetLoudspeakerArray(Context, Positions, NumLoudspeakers);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetLoudspeakerArray(CurrentContext, Positions, NumLoudspeakers);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetMappingMatrix(const float* Matrix,
 		                                                       int NumInputChannels, int NumOutputChannels)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetMappingMatrix(Context, Matrix, NumInputChannels, NumOutputChannels);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetMappingMatrix(CurrentContext, Matrix, NumInputChannels, NumOutputChannels);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetAmbisonicOrientation(
 			const float* Front,
 			const float* Up)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetAmbisonicOrientation(Context, Front, Up);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetAmbisonicOrientation(CurrentContext, Front, Up);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetListenerPosition(
 			const float* Position)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetListenerPosition(Context, Position);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetListenerPosition(CurrentContext, Position);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetListenerOrientation(
 			const float* Front,
 			const float* Up)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetListenerOrientation(Context, Front, Up);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetListenerOrientation(CurrentContext, Front, Up);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetListenerPose(const float* Position,
 		                                                      const float* Front, const float* Up)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetListenerPose(Context, Position, Front, Up);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetListenerPose(CurrentContext, Position, Front, Up);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetSourcePosition(int SourceId,
 		                                                        const float* Position)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetSourcePosition(Context, SourceId, Position);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetSourcePosition(CurrentContext, SourceId, Position);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetSourceGain(int SourceId, float Gain)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetSourceGain(Context, SourceId, Gain);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetSourceGain(CurrentContext, SourceId, Gain);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::SetSourceSize(int SourceId,
 		                                                    float VolumetricSize)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_SetSourceSize(Context, SourceId, VolumetricSize);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_SetSourceSize(CurrentContext, SourceId, VolumetricSize);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::UpdateSourceMode(int SourceId,
 		                                                       PxrAudioSpatializer_SourceMode Mode)
 		{
-			PxrAudioSpatializer_Result Result = PASP_SUCCESS;
-			if (ContextDestructionMutex.try_lock_shared())
+			return WithContext([&](PxrAudioSpatializer_Context* CurrentContext)
 			{
-				Result = PxrAudioSpatializer_UpdateSourceMode(Context, SourceId, Mode);
-				ContextDestructionMutex.unlock_shared();
-			}
-			return Result;
+				return PxrAudioSpatializer_UpdateSourceMode(CurrentContext, SourceId, Mode);
+			});
 		}
 
 		PxrAudioSpatializer_Result APINative::Destroy()
 		{
-			ContextDestructionMutex.lock();
-			const auto Result = PxrAudioSpatializer_Destroy(Context);
-			Context = nullptr;
-			ContextDestructionMutex.unlock();
-			return Result;
+			PxrAudioSpatializer_Context* OldContext = Context.exchange(nullptr);
+			if (OldContext == nullptr)
+			{
+				OldContext = PendingContext;
+			}
+			PendingContext = nullptr;
+
+			//	Calls that loaded the old context before the exchange may still be running
+			WaitForReaders();
+			return PxrAudioSpatializer_Destroy(OldContext);
 		}
 	}
 }
@@ -2,7 +2,7 @@
 #include "PxrAudioSpatializerApi.h"
 #include "pxr_audio_spatializer.h"
 #include "pxr_audio_spatializer_types.h"
-#include <shared_mutex>
+#include <atomic>
 
 namespace Pxr_Audio
 {
@@ -12,7 +12,7 @@ namespace Pxr_Audio
 		class APINative final : public API
 		{
 		public:
-			APINative() : Context(nullptr)
+			APINative() : ReaderEpoch(0), Context(nullptr), PendingContext(nullptr)
 			{
 			}
 
@@ -138,8 +138,40 @@ namespace Pxr_Audio
 				PxrAudioSpatializer_SourceMode Mode) override;
 			virtual PxrAudioSpatializer_Result Destroy() override;
 		private:
-			PxrAudioSpatializer_Context* Context;
-			std::shared_timed_mutex ContextDestructionMutex;
+			//	Threads inside an API call are counted per thread slot, one cache line each, instead of on a shared
+			//	lock, so the audio thread only ever writes its own line. Each call is counted under the epoch it
+			//	started in. Destroy() unpublishes the context, then advances the epoch and waits for the calls of the
+			//	previous one to drain (twice, so calls that read the epoch just before it moved are covered too).
+			//	Calls that start meanwhile count under the new epoch and see no context, so they never hold it up.
+			static constexpr int NumReaderSlots = 16;
+
+			struct alignas(64) FReaderSlot
+			{
+				std::atomic<int> NumReaders[2] = {{0}, {0}};
+			};
+
+			template <typename FuncType>
+			PxrAudioSpatializer_Result WithContext(FuncType&& Func)
+			{
+				std::atomic<int>& NumReaders = ReaderSlots[GetReaderSlotIndex()].NumReaders[ReaderEpoch.load() & 1];
+				NumReaders.fetch_add(1);
+				PxrAudioSpatializer_Context* CurrentContext = Context.load();
+				const PxrAudioSpatializer_Result Result = CurrentContext != nullptr
+					                                          ? Func(CurrentContext)
+					                                          : PASP_CONTEXT_NOT_CREATED;
+				NumReaders.fetch_sub(1, std::memory_order_release);
+				return Result;
+			}
+
+			static int GetReaderSlotIndex();
+			void WaitForReaders();
+
+			std::atomic<unsigned int> ReaderEpoch;
+			//	Published once initialized, only then visible to API calls
+			std::atomic<PxrAudioSpatializer_Context*> Context;
+			//	Created but not yet initialized, owned by the thread creating the context
+			PxrAudioSpatializer_Context* PendingContext;
+			FReaderSlot ReaderSlots[NumReaderSlots];
 		};
 	}
 }
@@ -9,7 +9,8 @@
 UPicoSpatialAudioSceneGeometryComponent::UPicoSpatialAudioSceneGeometryComponent()
 	: InternalGeomId(-1),
 	  InternalBakedGeomId(-1),
-	  bSubmitted(false)
+	  bSubmitted(false),
+	  LastDynamicUpdateTime(0.0)
 {
 	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
 	// off to improve performance if you don't need them.
@@ -46,6 +47,119 @@ void UPicoSpatialAudioSceneGeometryComponent::TickComponent(float DeltaTime, ELe
 
 		bSubmitted = true;
 	}
+
+	if (bSubmitted)
+	{
+		if (bDynamicGeometry && NeedsDynamicUpdate())
+		{
+			if (GetWorld()->GetTimeSeconds() - LastDynamicUpdateTime < DynamicUpdateInterval)
+			{
+				return;
+			}
+			UpdateDynamicGeometry();
+		}
+
+		//	Nothing left to do until the geometry moves again (see OnTransformUpdated)
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UPicoSpatialAudioSceneGeometryComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	if (bDynamicGeometry)
+	{
+		TransformUpdated.AddUObject(this, &UPicoSpatialAudioSceneGeometryComponent::OnTransformUpdated);
+	}
+}
+
+void UPicoSpatialAudioSceneGeometryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	TransformUpdated.RemoveAll(this);
+	Super::EndPlay(EndPlayReason);
+}
+
+void UPicoSpatialAudioSceneGeometryComponent::OnTransformUpdated(USceneComponent* UpdatedComponent,
+                                                                 EUpdateTransformFlags UpdateTransformFlags,
+                                                                 ETeleportType Teleport)
+{
+	if (bSubmitted && !IsComponentTickEnabled())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UPicoSpatialAudioSceneGeometryComponent::PlaceDynamicVertices(const FTransform& ComponentTransform)
+{
+	//	Component space -> world space, wrapped in the Unreal <-> Pico axis conversion of ConvertToPicoSpatialAudioCoordinates
+	const FMatrix PicoToUnreal(FPlane(0.f, 100.f, 0.f, 0.f), FPlane(0.f, 0.f, 100.f, 0.f),
+	                           FPlane(-100.f, 0.f, 0.f, 0.f), FPlane(0.f, 0.f, 0.f, 1.f));
+	const FMatrix UnrealToPico(FPlane(0.f, 0.f, -0.01f, 0.f), FPlane(0.01f, 0.f, 0.f, 0.f),
+	                           FPlane(0.f, 0.01f, 0.f, 0.f), FPlane(0.f, 0.f, 0.f, 1.f));
+	const FMatrix LocalToWorldPico = PicoToUnreal * ComponentTransform.ToMatrixWithScale() * UnrealToPico;
+
+	const int32 NumVertices = DynamicLocalVerticesBuffer.Num() / 3;
+	BatchedMeshVerticesBuffer.SetNumUninitialized(NumVertices * 3, false);
+	const float* LocalVertex = DynamicLocalVerticesBuffer.GetData();
+	float* WorldVertex = BatchedMeshVerticesBuffer.GetData();
+	for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+	{
+		const FVector Position = LocalToWorldPico.TransformPosition(
+			FVector(LocalVertex[0], LocalVertex[1], LocalVertex[2]));
+		WorldVertex[0] = Position.X;
+		WorldVertex[1] = Position.Y;
+		WorldVertex[2] = Position.Z;
+		LocalVertex += 3;
+		WorldVertex += 3;
+	}
+}
+
+bool UPicoSpatialAudioSceneGeometryComponent::NeedsDynamicUpdate() const
+{
+	if (InternalGeomId == -1)
+	{
+		return false;
+	}
+
+	const FTransform& CurrentTransform = GetComponentTransform();
+	return FVector::DistSquared(CurrentTransform.GetLocation(), SubmittedTransform.GetLocation()) >
+		FMath::Square(DynamicPositionTolerance) ||
+		CurrentTransform.GetRotation().AngularDistance(SubmittedTransform.GetRotation()) >
+		FMath::DegreesToRadians(DynamicRotationTolerance) ||
+		!CurrentTransform.GetScale3D().Equals(SubmittedTransform.GetScale3D(), KINDA_SMALL_NUMBER);
+}
+
+void UPicoSpatialAudioSceneGeometryComponent::UpdateDynamicGeometry()
+{
+	const FTransform CurrentTransform = GetComponentTransform();
+	PlaceDynamicVertices(CurrentTransform);
+	const int32 NumVertices = BatchedMeshVerticesBuffer.Num() / 3;
+
+	//	The indices never change; submit the moved copy before removing the old one so there is no frame without it
+	const float Absorption[4] = {
+		MaterialSettings->AbsorptionBand0, MaterialSettings->AbsorptionBand1, MaterialSettings->AbsorptionBand2,
+		MaterialSettings->AbsorptionBand3
+	};
+	int NewGeomId = -1;
+	auto* Context = Pxr_Audio::Spatializer::FContextSingleton::GetInstance();
+	auto Result = Context->SubmitMeshAndMaterialFactor(
+		BatchedMeshVerticesBuffer.GetData(), NumVertices, BatchedMeshIndicesBuffer.GetData(),
+		BatchedMeshIndicesBuffer.Num() / 3, Absorption, MaterialSettings->Scattering, MaterialSettings->Transmission,
+		&NewGeomId);
+	LastDynamicUpdateTime = GetWorld()->GetTimeSeconds();
+	if (Result != PASP_SUCCESS)
+	{
+		UE_LOG(LogPicoSpatialAudio, Error, TEXT("Failed to update dynamic mesh for Actor: %s, error code is: %d"),
+		       *GetOwner()->GetName(), Result);
+		return;
+	}
+
+	Result = Context->RemoveMesh(InternalGeomId);
+	UE_CLOG(Result != PASP_SUCCESS, LogPicoSpatialAudio, Error,
+	        TEXT("Failed to remove mesh #%d, error code is: %d"), InternalGeomId, Result);
+	InternalGeomId = NewGeomId;
+	SubmittedTransform = CurrentTransform;
+	Pxr_Audio::Spatializer::FListener::bNeedSceneCommit = true;
 }
 
 void UPicoSpatialAudioSceneGeometryComponent::BeginDestroy()
@@ -84,11 +198,27 @@ int32 UPicoSpatialAudioSceneGeometryComponent::SubmitToContext()
 	GatheredStaticMeshTransforms.Reset(0);
 	GatherStaticMeshes(GatheredStaticMeshes, GatheredStaticMeshTransforms, true);
 
+	//	1.1 Dynamic geometry is batched relative to this component, and placed in the world from that copy
+	SubmittedTransform = GetComponentTransform();
+	if (bDynamicGeometry)
+	{
+		for (FTransform& Transform : GatheredStaticMeshTransforms)
+		{
+			Transform = Transform.GetRelativeTransform(SubmittedTransform);
+		}
+	}
+
 	//	2. Batch UStaticMesh into one vertices and indices buffer;
 	//	2.1 count gathered vertices and indices
 	BatchStaticMeshes(GatheredStaticMeshes, GatheredStaticMeshTransforms, BatchedMeshVerticesBuffer,
 	                  BatchedMeshIndicesBuffer);
 
+	if (bDynamicGeometry)
+	{
+		DynamicLocalVerticesBuffer = BatchedMeshVerticesBuffer;
+		PlaceDynamicVertices(SubmittedTransform);
+	}
+
 	//	3. Submit batched UStaticMeshes to engine
 	if (BatchedMeshVerticesBuffer.Num() > 0 && BatchedMeshIndicesBuffer.Num() > 0)
 	{
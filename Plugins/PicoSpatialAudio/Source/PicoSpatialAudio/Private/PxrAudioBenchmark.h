@@ -0,0 +1,71 @@
+#pragma once
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/PlatformMisc.h"
+#include "Misc/App.h"
+#include "Misc/Parse.h"
+
+/**
+ * Parameters and correctness checks of the spatializer benchmark console commands, e.g.
+ *   UE4Editor Prototypes -game -nullrhi -unattended -stdout -ExecCmds="pxr.Audio.BenchmarkKernels Sources=64,quit"
+ * A failed check is logged as an error and raises an ensure, and exits with code 1 under -unattended.
+ */
+class FPxrAudioBenchmark
+{
+public:
+	FPxrAudioBenchmark(const TCHAR* InName, const TArray<FString>& Args, FOutputDevice& InAr)
+		: Ar(InAr)
+		, Name(InName)
+		, Params(FString::Join(Args, TEXT(" ")))
+		, NumFailures(0)
+	{
+	}
+
+	/** Value of Key (e.g. TEXT("Frames=")) on the command line, Default when it is not given */
+	template<typename ValueType>
+	ValueType Param(const TCHAR* Key, ValueType Default) const
+	{
+		ValueType Value = Default;
+		FParse::Value(*Params, Key, Value);
+		return Value;
+	}
+
+	/** Fails the run unless bCondition holds, Fmt describes what was compared */
+	template<typename FmtType, typename... Types>
+	bool Check(bool bCondition, const FmtType& Fmt, Types... Args)
+	{
+		if (!bCondition)
+		{
+			NumFailures++;
+			const FString Message = FString::Printf(Fmt, Args...);
+			Ar.Logf(ELogVerbosity::Error, TEXT("%s: check failed: %s"), Name, *Message);
+			ensureMsgf(false, TEXT("%s: check failed: %s"), Name, *Message);
+		}
+		return bCondition;
+	}
+
+	/** Prints the verdict and returns the number of failed checks */
+	int32 Finish() const
+	{
+		if (NumFailures == 0)
+		{
+			Ar.Logf(TEXT("%s: passed"), Name);
+			return 0;
+		}
+		Ar.Logf(ELogVerbosity::Error, TEXT("%s: FAILED, %d check(s) did not hold"), Name, NumFailures);
+		if (FApp::IsUnattended())
+		{
+			FPlatformMisc::RequestExitWithStatus(false, 1);
+		}
+		return NumFailures;
+	}
+
+	FOutputDevice& Ar;
+
+private:
+	const TCHAR* Name;
+	FString Params;
+	int32 NumFailures;
+};
+#endif
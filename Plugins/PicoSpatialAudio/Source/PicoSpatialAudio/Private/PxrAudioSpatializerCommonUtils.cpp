@@ -1,4 +1,5 @@
 #include "PxrAudioSpatializerCommonUtils.h"
+#include "PxrAudioSpatializerKernels.h"
 
 DEFINE_LOG_CATEGORY(LogPicoSpatialAudio);
 
@@ -66,13 +67,12 @@ namespace Pxr_Audio
 			const int32 NumChannels = PlannerBuffers.Num();
 			const int32 NumFrames = InterleavedBuffer.Num() / NumChannels;
 
-			for (int32 frame = 0; frame < NumFrames; ++frame)
+			TArray<float*, TInlineAllocator<16>> ChannelPtrs;
+			for (Audio::AlignedFloatBuffer& PlannerBuffer : PlannerBuffers)
 			{
-				for (int32 channel = 0; channel < NumChannels; ++channel)
-				{
-					PlannerBuffers[channel][frame] = InterleavedBuffer[frame * NumChannels + channel];
-				}
+				ChannelPtrs.Add(PlannerBuffer.GetData());
 			}
+			Kernels::Deinterleave(InterleavedBuffer.GetData(), ChannelPtrs.GetData(), NumFrames, NumChannels);
 		}
 
 		float DB2Mag(const float DB)
@@ -0,0 +1,132 @@
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include <atomic>
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "PicoSpatialAudioEngine/PxrAudioSpatializerApiNative.h"
+
+//	Creates and destroys a private spatializer context in a loop while simulated audio threads keep calling into it, e.g.
+//	  UE4Editor Prototypes -game -nullrhi -unattended -stdout -ExecCmds="pxr.Audio.StressContextLifetime Seconds=30 AudioThreads=2,quit"
+//	It does not touch FContextSingleton, so it can run next to the active spatializer.
+namespace Pxr_Audio
+{
+	namespace Spatializer
+	{
+		namespace ContextStress
+		{
+			struct FAudioThreadStats
+			{
+				uint64 NumCalls = 0;
+				uint64 NumWithoutContext = 0;
+				uint64 MaxCallCycles = 0;
+			};
+
+			static FAudioThreadStats RunAudioThread(APINative& Api, const std::atomic<bool>& bStop, int32 NumFrames)
+			{
+				FAudioThreadStats Stats;
+				TArray<float> SourceBuffer;
+				TArray<float> BinauralBuffer;
+				SourceBuffer.SetNumZeroed(NumFrames);
+				BinauralBuffer.SetNumZeroed(2 * NumFrames);
+				float Position[3] = {0.f, 0.f, -1.f};
+
+				while (!bStop.load(std::memory_order_relaxed))
+				{
+					const uint64 StartCycles = FPlatformTime::Cycles64();
+					Api.SetSourcePosition(0, Position);
+					Api.SubmitSourceBuffer(0, SourceBuffer.GetData(), NumFrames);
+					const PxrAudioSpatializer_Result Result = Api.GetInterleavedBinauralBuffer(
+						BinauralBuffer.GetData(), NumFrames, false);
+					Stats.MaxCallCycles = FMath::Max(Stats.MaxCallCycles, FPlatformTime::Cycles64() - StartCycles);
+
+					++Stats.NumCalls;
+					if (Result == PASP_CONTEXT_NOT_CREATED)
+					{
+						++Stats.NumWithoutContext;
+					}
+				}
+				return Stats;
+			}
+
+			static void Execute(const TArray<FString>& Args, FOutputDevice& Ar)
+			{
+				float Seconds = 10.0f;
+				int32 NumAudioThreads = 2;
+				int32 NumFrames = 1024;
+				int32 SampleRate = 48000;
+				float HoldMs = 2.0f;
+				for (const FString& Arg : Args)
+				{
+					FParse::Value(*Arg, TEXT("Seconds="), Seconds);
+					FParse::Value(*Arg, TEXT("AudioThreads="), NumAudioThreads);
+					FParse::Value(*Arg, TEXT("Frames="), NumFrames);
+					FParse::Value(*Arg, TEXT("SampleRate="), SampleRate);
+					FParse::Value(*Arg, TEXT("HoldMs="), HoldMs);
+				}
+				NumAudioThreads = FMath::Clamp(NumAudioThreads, 1, 8);
+				NumFrames = FMath::Max(NumFrames, 64);
+
+				APINative Api;
+				std::atomic<bool> bStop(false);
+				TArray<TFuture<FAudioThreadStats>> AudioThreads;
+				for (int32 i = 0; i < NumAudioThreads; ++i)
+				{
+					AudioThreads.Add(Async(EAsyncExecution::Thread, [&Api, &bStop, NumFrames]()
+					{
+						return RunAudioThread(Api, bStop, NumFrames);
+					}));
+				}
+
+				uint64 NumCycles = 0;
+				uint64 NumFailures = 0;
+				uint64 MaxDestroyCycles = 0;
+				const double EndTime = FPlatformTime::Seconds() + Seconds;
+				while (FPlatformTime::Seconds() < EndTime)
+				{
+					PxrAudioSpatializer_Result Result = Api.CreateContext(PASP_LOW_QUALITY, NumFrames, SampleRate);
+					if (Result == PASP_SUCCESS)
+					{
+						Result = Api.InitializeContext();
+					}
+					if (Result == PASP_SUCCESS)
+					{
+						int SourceId = -1;
+						PxrAudioSpatializer_SourceConfig SourceConfig;
+						Api.AddSourceWithConfig(&SourceConfig, &SourceId);
+					}
+					else
+					{
+						++NumFailures;
+					}
+					FPlatformProcess::Sleep(HoldMs / 1000.0f);
+
+					const uint64 StartCycles = FPlatformTime::Cycles64();
+					Api.Destroy();
+					MaxDestroyCycles = FMath::Max(MaxDestroyCycles, FPlatformTime::Cycles64() - StartCycles);
+					++NumCycles;
+				}
+
+				bStop = true;
+				Ar.Logf(TEXT("Spatializer context stress: %llu create/destroy cycles (%llu failed to initialize), max Destroy %.3f ms"),
+				        NumCycles, NumFailures, FPlatformTime::ToMilliseconds64(MaxDestroyCycles));
+				for (int32 i = 0; i < AudioThreads.Num(); ++i)
+				{
+					const FAudioThreadStats Stats = AudioThreads[i].Get();
+					Ar.Logf(TEXT("  audio thread %d: %llu callbacks, %llu without a context, max callback %.3f ms"), i,
+					        Stats.NumCalls, Stats.NumWithoutContext, FPlatformTime::ToMilliseconds64(Stats.MaxCallCycles));
+				}
+			}
+
+			static FAutoConsoleCommandWithWorldArgsAndOutputDevice StressCommand(
+				TEXT("pxr.Audio.StressContextLifetime"),
+				TEXT("Creates and destroys a spatializer context while audio threads call into it. Seconds= AudioThreads= Frames= SampleRate= HoldMs="),
+				FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda(
+					[](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar) { Execute(Args, Ar); }));
+		}
+	}
+}
+#endif
@@ -0,0 +1,145 @@
+#include "PxrAudioSpatializerKernels.h"
+#include "Math/VectorRegister.h"
+
+namespace Pxr_Audio
+{
+	namespace Spatializer
+	{
+		namespace Kernels
+		{
+			void DownmixToMono(const float* In, float* Out, int32 NumFrames, int32 NumChannels)
+			{
+				if (NumChannels == 1)
+				{
+					if (In != Out)
+					{
+						FMemory::Memcpy(Out, In, NumFrames * sizeof(float));
+					}
+					return;
+				}
+
+				const float Scale = 1.0f / static_cast<float>(NumChannels);
+				int32 Frame = 0;
+				if (NumChannels == 2)
+				{
+					// Four frames per iteration; both loads happen before the store, so in-place is safe
+					const VectorRegister Half = VectorSetFloat1(Scale);
+					for (; Frame + 4 <= NumFrames; Frame += 4)
+					{
+						const VectorRegister A = VectorLoad(In + 2 * Frame);
+						const VectorRegister B = VectorLoad(In + 2 * Frame + 4);
+						const VectorRegister Left = VectorShuffle(A, B, 0, 2, 0, 2);
+						const VectorRegister Right = VectorShuffle(A, B, 1, 3, 1, 3);
+						VectorStore(VectorMultiply(VectorAdd(Left, Right), Half), Out + Frame);
+					}
+				}
+
+				for (; Frame < NumFrames; ++Frame)
+				{
+					const float* FrameIn = In + Frame * NumChannels;
+					float Sum = FrameIn[0];
+					for (int32 Channel = 1; Channel < NumChannels; ++Channel)
+					{
+						Sum += FrameIn[Channel];
+					}
+					Out[Frame] = Sum * Scale;
+				}
+			}
+
+			void Deinterleave(const float* In, float* const* Out, int32 NumFrames, int32 NumChannels)
+			{
+				if (NumChannels == 1)
+				{
+					FMemory::Memcpy(Out[0], In, NumFrames * sizeof(float));
+					return;
+				}
+
+				if (NumChannels == 2)
+				{
+					float* Left = Out[0];
+					float* Right = Out[1];
+					int32 Frame = 0;
+					for (; Frame + 4 <= NumFrames; Frame += 4)
+					{
+						const VectorRegister A = VectorLoad(In + 2 * Frame);
+						const VectorRegister B = VectorLoad(In + 2 * Frame + 4);
+						VectorStore(VectorShuffle(A, B, 0, 2, 0, 2), Left + Frame);
+						VectorStore(VectorShuffle(A, B, 1, 3, 1, 3), Right + Frame);
+					}
+					for (; Frame < NumFrames; ++Frame)
+					{
+						Left[Frame] = In[2 * Frame];
+						Right[Frame] = In[2 * Frame + 1];
+					}
+					return;
+				}
+
+				// One output stream at a time keeps the writes sequential
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					float* ChannelOut = Out[Channel];
+					const float* ChannelIn = In + Channel;
+					for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+					{
+						ChannelOut[Frame] = ChannelIn[Frame * NumChannels];
+					}
+				}
+			}
+
+			void StereoFanOut(const float* InStereo, float* Out, int32 NumFrames, int32 OutNumChannels)
+			{
+				if (OutNumChannels == 2)
+				{
+					FMemory::Memcpy(Out, InStereo, 2 * NumFrames * sizeof(float));
+					return;
+				}
+
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					FMemory::Memcpy(Out + Frame * OutNumChannels, InStereo + 2 * Frame, 2 * sizeof(float));
+				}
+			}
+
+			void MixInChannels(const float* In, int32 InNumChannels, float* Out, int32 OutNumChannels,
+			                   int32 NumFrames, int32 NumChannelsToMix, float Gain)
+			{
+				const VectorRegister GainVector = VectorSetFloat1(Gain);
+
+				// Identical layouts are one contiguous run
+				if (InNumChannels == NumChannelsToMix && OutNumChannels == NumChannelsToMix)
+				{
+					const int32 NumSamples = NumFrames * NumChannelsToMix;
+					int32 Sample = 0;
+					for (; Sample + 4 <= NumSamples; Sample += 4)
+					{
+						const VectorRegister Result = VectorMultiplyAdd(VectorLoad(In + Sample), GainVector,
+						                                                VectorLoad(Out + Sample));
+						VectorStore(Result, Out + Sample);
+					}
+					for (; Sample < NumSamples; ++Sample)
+					{
+						Out[Sample] += Gain * In[Sample];
+					}
+					return;
+				}
+
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					const float* FrameIn = In + Frame * InNumChannels;
+					float* FrameOut = Out + Frame * OutNumChannels;
+					int32 Channel = 0;
+					for (; Channel + 4 <= NumChannelsToMix; Channel += 4)
+					{
+						const VectorRegister Result = VectorMultiplyAdd(VectorLoad(FrameIn + Channel), GainVector,
+						                                                VectorLoad(FrameOut + Channel));
+						VectorStore(Result, FrameOut + Channel);
+					}
+					for (; Channel < NumChannelsToMix; ++Channel)
+					{
+						FrameOut[Channel] += Gain * FrameIn[Channel];
+					}
+				}
+			}
+		}
+	}
+}
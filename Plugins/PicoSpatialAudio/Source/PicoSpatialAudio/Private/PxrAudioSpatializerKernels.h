@@ -0,0 +1,38 @@
+#pragma once
+#include "CoreMinimal.h"
+
+namespace Pxr_Audio
+{
+	namespace Spatializer
+	{
+		/**
+		 * @brief Buffer conversion kernels used on the audio render thread.
+		 * Built on the engine vector intrinsics (SSE / NEON, scalar FPU fallback elsewhere); none of them allocate.
+		 */
+		namespace Kernels
+		{
+			/**
+			 * @brief Averages each interleaved frame down to one sample. Out may alias In (in-place downmix).
+			 */
+			void DownmixToMono(const float* In, float* Out, int32 NumFrames, int32 NumChannels);
+
+			/**
+			 * @brief Splits an interleaved buffer into one planar buffer per channel.
+			 */
+			void Deinterleave(const float* In, float* const* Out, int32 NumFrames, int32 NumChannels);
+
+			/**
+			 * @brief Writes an interleaved stereo buffer into the first two channels of an interleaved buffer
+			 * with OutNumChannels channels, leaving the remaining channels untouched.
+			 */
+			void StereoFanOut(const float* InStereo, float* Out, int32 NumFrames, int32 OutNumChannels);
+
+			/**
+			 * @brief Out[Frame][Channel] += Gain * In[Frame][Channel] for the first NumChannelsToMix channels
+			 * of two interleaved buffers with (possibly) different channel counts.
+			 */
+			void MixInChannels(const float* In, int32 InNumChannels, float* Out, int32 OutNumChannels,
+			                   int32 NumFrames, int32 NumChannelsToMix, float Gain = 1.0f);
+		}
+	}
+}
@@ -0,0 +1,259 @@
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "PxrAudioBenchmark.h"
+#include "PxrAudioSpatializerKernels.h"
+#include "PxrAudioSpatializerCommonUtils.h"
+
+//	Compares the buffer kernels against the scalar loops they replaced, which must produce the same samples.
+//	Each case runs the whole per-callback workload (one buffer per source) Iterations times.
+namespace Pxr_Audio
+{
+	namespace Spatializer
+	{
+		namespace KernelsBenchmark
+		{
+			//	Reference loops, kept as they were in FSpatialization, FReverb and FAmbisonicsTranscoder
+			static void ReferenceDownmix(float* InputBuffer, int32 NumSamples, int32 NumChannels)
+			{
+				size_t BufferWriteIdx = 0;
+				for (size_t Frame = 0; Frame < static_cast<size_t>(NumSamples); Frame += NumChannels)
+				{
+					InputBuffer[BufferWriteIdx] = InputBuffer[Frame];
+					for (size_t Channel = 1; Channel < static_cast<size_t>(NumChannels); ++Channel)
+					{
+						InputBuffer[BufferWriteIdx] += InputBuffer[Frame + Channel];
+					}
+					InputBuffer[BufferWriteIdx++] /= static_cast<float>(NumChannels);
+				}
+			}
+
+			static void ReferenceDeinterleave(const float* In, TArray<Audio::AlignedFloatBuffer>& PlannerBuffers,
+			                                  int32 NumFrames)
+			{
+				const int32 NumChannels = PlannerBuffers.Num();
+				for (int32 frame = 0; frame < NumFrames; ++frame)
+				{
+					for (int32 channel = 0; channel < NumChannels; ++channel)
+					{
+						PlannerBuffers[channel][frame] = In[frame * NumChannels + channel];
+					}
+				}
+			}
+
+			static void ReferenceFanOut(Audio::AlignedFloatBuffer& TemporaryStereoBuffer, const float* Binaural,
+			                            float* OutputBufferPtr, int32 NumFrames, int32 NumChannels)
+			{
+				TemporaryStereoBuffer.Reset();
+				TemporaryStereoBuffer.AddZeroed(2 * NumFrames);
+				FMemory::Memcpy(TemporaryStereoBuffer.GetData(), Binaural, 2 * NumFrames * sizeof(float));
+				for (int32 i = 0; i < NumFrames; ++i)
+				{
+					const int32 SubmixFrameHead = i * NumChannels;
+					const int32 StereoBufferFrameHead = i * 2;
+					OutputBufferPtr[SubmixFrameHead] = TemporaryStereoBuffer[StereoBufferFrameHead];
+					OutputBufferPtr[SubmixFrameHead + 1] = TemporaryStereoBuffer[StereoBufferFrameHead + 1];
+				}
+			}
+
+			static void ReferenceMixIn(const float* In, int32 InputChannelsCount, float* Out,
+			                           int32 OutputChannelsCount, int32 NumFrames)
+			{
+				const int32 NumChannelsToCopy = FMath::Min(InputChannelsCount, OutputChannelsCount);
+				for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+				{
+					for (int32 ChannelIndex = 0; ChannelIndex < NumChannelsToCopy; ChannelIndex++)
+					{
+						Out[FrameIndex * OutputChannelsCount + ChannelIndex] += In[FrameIndex * InputChannelsCount +
+							ChannelIndex];
+					}
+				}
+			}
+
+			static void FillNoise(Audio::AlignedFloatBuffer& Buffer, int32 NumSamples, FRandomStream& Random)
+			{
+				Buffer.SetNumUninitialized(NumSamples);
+				for (float& Sample : Buffer)
+				{
+					Sample = Random.FRandRange(-1.0f, 1.0f);
+				}
+			}
+
+			//	The downmix multiplies by the reciprocal instead of dividing, every other kernel only moves or adds samples
+			static const float MaxSampleError = 1e-6f;
+
+			static float MaxAbsDiff(const float* A, const float* B, int32 Num)
+			{
+				float Result = 0.0f;
+				for (int32 i = 0; i < Num; ++i)
+				{
+					Result = FMath::Max(Result, FMath::Abs(A[i] - B[i]));
+				}
+				return Result;
+			}
+
+			template <typename RefFunc, typename KernelFunc>
+			static void RunCase(FPxrAudioBenchmark& Benchmark, const TCHAR* Name, int32 Iterations, RefFunc&& Reference,
+			                    KernelFunc&& Kernel, float MaxError)
+			{
+				// Warm caches and branch predictors on both paths first
+				Reference();
+				Kernel();
+
+				uint64 StartCycles = FPlatformTime::Cycles64();
+				for (int32 i = 0; i < Iterations; ++i)
+				{
+					Reference();
+				}
+				const double ReferenceUs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) *
+					1000.0 / Iterations;
+
+				StartCycles = FPlatformTime::Cycles64();
+				for (int32 i = 0; i < Iterations; ++i)
+				{
+					Kernel();
+				}
+				const double KernelUs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) *
+					1000.0 / Iterations;
+
+				Benchmark.Ar.Logf(TEXT("  %-32s reference %9.2f us  kernel %9.2f us  x%5.2f  max error %g"), Name,
+				                  ReferenceUs, KernelUs, KernelUs > 0.0 ? ReferenceUs / KernelUs : 0.0, MaxError);
+				Benchmark.Check(MaxError <= MaxSampleError, TEXT("%s: kernel output differs from the reference by %g"),
+				                Name, MaxError);
+			}
+
+			static void Execute(const TArray<FString>& Args, FOutputDevice& Ar)
+			{
+				FPxrAudioBenchmark Benchmark(TEXT("pxr.Audio.BenchmarkKernels"), Args, Ar);
+				const int32 NumSources = FMath::Max(Benchmark.Param(TEXT("Sources="), 64), 1);
+				const int32 NumFrames = FMath::Max(Benchmark.Param(TEXT("Frames="), 1024), 1);
+				const int32 Iterations = FMath::Max(Benchmark.Param(TEXT("Iterations="), 1000), 1);
+				const int32 NumSubmixChannels = FMath::Max(Benchmark.Param(TEXT("SubmixChannels="), 8), 3);
+				const int32 AmbisonicOrder = FMath::Clamp(Benchmark.Param(TEXT("Order="), 3), 1, 7);
+
+				FRandomStream Random(0x5eed);
+				Ar.Logf(TEXT("Pico spatial audio kernels: %d sources, %d frames, %d iterations"), NumSources,
+				        NumFrames, Iterations);
+
+				//	Per-source stereo downmix, as FSpatialization::ProcessAudio does for every source
+				{
+					Audio::AlignedFloatBuffer Source;
+					FillNoise(Source, 2 * NumFrames, Random);
+					Audio::AlignedFloatBuffer RefBuffer = Source;
+					Audio::AlignedFloatBuffer KernelBuffer = Source;
+					ReferenceDownmix(RefBuffer.GetData(), RefBuffer.Num(), 2);
+					Kernels::DownmixToMono(KernelBuffer.GetData(), KernelBuffer.GetData(), NumFrames, 2);
+					const float MaxError = MaxAbsDiff(RefBuffer.GetData(), KernelBuffer.GetData(), NumFrames);
+
+					RunCase(Benchmark, TEXT("Stereo downmix (all sources)"), Iterations, [&]()
+					        {
+						        for (int32 i = 0; i < NumSources; ++i)
+						        {
+							        FMemory::Memcpy(RefBuffer.GetData(), Source.GetData(), Source.Num() * sizeof(float));
+							        ReferenceDownmix(RefBuffer.GetData(), RefBuffer.Num(), 2);
+						        }
+					        }, [&]()
+					        {
+						        for (int32 i = 0; i < NumSources; ++i)
+						        {
+							        FMemory::Memcpy(KernelBuffer.GetData(), Source.GetData(), Source.Num() * sizeof(float));
+							        Kernels::DownmixToMono(KernelBuffer.GetData(), KernelBuffer.GetData(), NumFrames, 2);
+						        }
+					        }, MaxError);
+				}
+
+				//	Binaural output into the first two channels of a surround submix
+				{
+					Audio::AlignedFloatBuffer Binaural;
+					FillNoise(Binaural, 2 * NumFrames, Random);
+					Audio::AlignedFloatBuffer TemporaryStereoBuffer;
+					Audio::AlignedFloatBuffer RefOut;
+					Audio::AlignedFloatBuffer KernelOut;
+					RefOut.SetNumZeroed(NumSubmixChannels * NumFrames);
+					KernelOut.SetNumZeroed(NumSubmixChannels * NumFrames);
+					ReferenceFanOut(TemporaryStereoBuffer, Binaural.GetData(), RefOut.GetData(), NumFrames,
+					                NumSubmixChannels);
+					Kernels::StereoFanOut(Binaural.GetData(), KernelOut.GetData(), NumFrames, NumSubmixChannels);
+					const float MaxError = MaxAbsDiff(RefOut.GetData(), KernelOut.GetData(), RefOut.Num());
+
+					RunCase(Benchmark, TEXT("Stereo fan-out (reverb submix)"), Iterations, [&]()
+					        {
+						        ReferenceFanOut(TemporaryStereoBuffer, Binaural.GetData(), RefOut.GetData(), NumFrames,
+						                        NumSubmixChannels);
+					        }, [&]()
+					        {
+						        Kernels::StereoFanOut(Binaural.GetData(), KernelOut.GetData(), NumFrames, NumSubmixChannels);
+					        }, MaxError);
+				}
+
+				//	Ambisonic encoder input split into per-channel sources
+				{
+					const int32 NumChannels = (AmbisonicOrder + 1) * (AmbisonicOrder + 1);
+					Audio::AlignedFloatBuffer Interleaved;
+					FillNoise(Interleaved, NumChannels * NumFrames, Random);
+					TArray<Audio::AlignedFloatBuffer> RefPlanner;
+					TArray<Audio::AlignedFloatBuffer> KernelPlanner;
+					RefPlanner.SetNum(NumChannels);
+					KernelPlanner.SetNum(NumChannels);
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						RefPlanner[Channel].SetNumZeroed(NumFrames);
+						KernelPlanner[Channel].SetNumZeroed(NumFrames);
+					}
+					ReferenceDeinterleave(Interleaved.GetData(), RefPlanner, NumFrames);
+					InterleavedToPlannerBuffer(Interleaved, KernelPlanner);
+					float MaxError = 0.0f;
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						MaxError = FMath::Max(MaxError, MaxAbsDiff(RefPlanner[Channel].GetData(),
+						                                           KernelPlanner[Channel].GetData(), NumFrames));
+					}
+
+					RunCase(Benchmark, TEXT("Ambisonic deinterleave"), Iterations, [&]()
+					        {
+						        ReferenceDeinterleave(Interleaved.GetData(), RefPlanner, NumFrames);
+					        }, [&]()
+					        {
+						        InterleavedToPlannerBuffer(Interleaved, KernelPlanner);
+					        }, MaxError);
+				}
+
+				//	Transcoding a higher order packet into a lower order one
+				{
+					const int32 InChannels = (AmbisonicOrder + 1) * (AmbisonicOrder + 1);
+					const int32 OutChannels = 4;
+					Audio::AlignedFloatBuffer In;
+					FillNoise(In, InChannels * NumFrames, Random);
+					Audio::AlignedFloatBuffer RefOut;
+					Audio::AlignedFloatBuffer KernelOut;
+					RefOut.SetNumZeroed(OutChannels * NumFrames);
+					KernelOut.SetNumZeroed(OutChannels * NumFrames);
+					ReferenceMixIn(In.GetData(), InChannels, RefOut.GetData(), OutChannels, NumFrames);
+					Kernels::MixInChannels(In.GetData(), InChannels, KernelOut.GetData(), OutChannels, NumFrames,
+					                       FMath::Min(InChannels, OutChannels));
+					const float MaxError = MaxAbsDiff(RefOut.GetData(), KernelOut.GetData(), RefOut.Num());
+
+					RunCase(Benchmark, TEXT("Ambisonic transcode mix-in"), Iterations, [&]()
+					        {
+						        ReferenceMixIn(In.GetData(), InChannels, RefOut.GetData(), OutChannels, NumFrames);
+					        }, [&]()
+					        {
+						        Kernels::MixInChannels(In.GetData(), InChannels, KernelOut.GetData(), OutChannels,
+						                               NumFrames, FMath::Min(InChannels, OutChannels));
+					        }, MaxError);
+				}
+
+				Benchmark.Finish();
+			}
+
+			static FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchmarkCommand(
+				TEXT("pxr.Audio.BenchmarkKernels"),
+				TEXT("Times the spatializer buffer kernels against the scalar loops they replaced and fails when their output differs. Sources= Frames= Iterations= SubmixChannels= Order="),
+				FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda(
+					[](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar) { Execute(Args, Ar); }));
+		}
+	}
+}
+#endif
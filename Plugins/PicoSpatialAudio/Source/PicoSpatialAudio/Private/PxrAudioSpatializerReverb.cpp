@@ -1,4 +1,5 @@
 #include "PxrAudioSpatializerReverb.h"
+#include "PxrAudioSpatializerKernels.h"
 
 namespace Pxr_Audio
 {
@@ -118,19 +119,9 @@ namespace Pxr_Audio
 			}
 			else if (OutData.NumChannels > 2) //	Fill output to the first 2 channels
 			{
-				TemporaryStereoBuffer.Reset();
-				TemporaryStereoBuffer.AddZeroed(2 * InData.NumFrames);
-
-				FContextSingleton::GetInstance()->GetInterleavedBinauralBuffer(TemporaryStereoBuffer.GetData(),
-				                                                               OutData.AudioBuffer->Num() / 2, false);
-				float* OutputBufferPtr = OutData.AudioBuffer->GetData();
-				for (int32 i = 0; i < InData.NumFrames; ++i)
-				{
-					const int32 SubmixFrameHead = i * OutData.NumChannels;
-					const int32 StereoBufferFrameHead = i * 2;
-					OutputBufferPtr[SubmixFrameHead] = TemporaryStereoBuffer[StereoBufferFrameHead];
-					OutputBufferPtr[SubmixFrameHead + 1] = TemporaryStereoBuffer[StereoBufferFrameHead + 1];
-				}
+				FillTemporaryStereoBuffer(InData.NumFrames);
+				Kernels::StereoFanOut(TemporaryStereoBuffer.GetData(), OutData.AudioBuffer->GetData(), InData.NumFrames,
+				                      OutData.NumChannels);
 			}
 			else if (OutData.NumChannels == 1)
 			{
@@ -139,19 +130,25 @@ namespace Pxr_Audio
 					       "Reverb is connected to 1-channel output, down-mixing binaural audio (sound quality is degraded)"
 				       ));
 
-				// FillInterleavedOutputBuffer (below) can fail if the graph does not have any sources to process, so the temp buffer must be zeroed
-				TemporaryStereoBuffer.Reset();
-				TemporaryStereoBuffer.AddZeroed(2 * InData.NumFrames);
+				FillTemporaryStereoBuffer(InData.NumFrames);
+				Kernels::DownmixToMono(TemporaryStereoBuffer.GetData(), OutData.AudioBuffer->GetData(), InData.NumFrames, 2);
+			}
+		}
 
-				FContextSingleton::GetInstance()->GetInterleavedBinauralBuffer(TemporaryStereoBuffer.GetData(),
-				                                                               OutData.AudioBuffer->Num() / 2, false);
-				float* OutputBufferPtr = OutData.AudioBuffer->GetData();
-				for (int32 i = 0; i < InData.NumFrames; ++i)
-				{
-					const int32 StereoBufferFrameHead = i * 2;
-					OutputBufferPtr[i] = 0.5f * (TemporaryStereoBuffer[StereoBufferFrameHead] +
-						TemporaryStereoBuffer[StereoBufferFrameHead + 1]);
-				}
+		void FReverb::FillTemporaryStereoBuffer(int32 NumFrames)
+		{
+			//	Only grows, so steady-state callbacks neither allocate nor clear it
+			if (TemporaryStereoBuffer.Num() < 2 * NumFrames)
+			{
+				TemporaryStereoBuffer.SetNumUninitialized(2 * NumFrames);
+			}
+
+			//	Fetching the binaural mix fails when the graph has no sources to process; output silence then
+			const auto Result = FContextSingleton::GetInstance()->GetInterleavedBinauralBuffer(
+				TemporaryStereoBuffer.GetData(), NumFrames, false);
+			if (Result != PASP_SUCCESS)
+			{
+				FMemory::Memzero(TemporaryStereoBuffer.GetData(), 2 * NumFrames * sizeof(float));
 			}
 		}
 
@@ -36,6 +36,7 @@ namespace Pxr_Audio
 			UPxrAudioSpatializerReverbPluginPreset* ReverbPreset;
 
 			void InitSubmixEffect();
+			void FillTemporaryStereoBuffer(int32 NumFrames);
 		};
 	}
 }
@@ -1,4 +1,5 @@
 #include "PxrAudioSpatializerSpatialization.h"
+#include "PxrAudioSpatializerKernels.h"
 
 namespace Pxr_Audio
 {
@@ -271,16 +272,8 @@ namespace Pxr_Audio
 			if (InputData.NumChannels > 1)
 			{
 				float* InputBuffer = InputData.AudioBuffer->GetData();
-				size_t BufferWriteIdx = 0;
-				for (size_t Frame = 0; Frame < InputData.AudioBuffer->Num(); Frame += InputData.NumChannels)
-				{
-					InputBuffer[BufferWriteIdx] = InputBuffer[Frame];
-					for (size_t Channel = 1; Channel < InputData.NumChannels; ++Channel)
-					{
-						InputBuffer[BufferWriteIdx] += InputBuffer[Frame + Channel];
-					}
-					InputBuffer[BufferWriteIdx++] /= static_cast<float>(InputData.NumChannels);
-				}
+				Kernels::DownmixToMono(InputBuffer, InputBuffer, InputData.AudioBuffer->Num() / InputData.NumChannels,
+				                       InputData.NumChannels);
 			}
 
 			// Add source buffer to process.
@@ -23,7 +23,9 @@ public:
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 	                           FActorComponentTickFunction* ThisTickFunction) override;
-	
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void BeginDestroy() override;
 
 	int32 SubmitToContext();
@@ -38,6 +40,20 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Settings")
 	UPicoSpatialAudioSceneMaterialSettings* MaterialSettings;
 
+	// Geometry that moves at runtime (doors, vehicles, elevators). Meshes are gathered once relative to this component
+	// and only re-placed when it moves; attach this component to the moving part. Baked meshes stay static.
+	UPROPERTY(EditAnywhere, Category = "Dynamic Geometry")
+	bool bDynamicGeometry = false;
+	// Minimum seconds between two updates of a moving geometry, the pose it comes to rest in is always submitted
+	UPROPERTY(EditAnywhere, Category = "Dynamic Geometry", meta = (EditCondition = "bDynamicGeometry", ClampMin = "0.0"))
+	float DynamicUpdateInterval = 0.1f;
+	// Movement in cm below which a moving geometry is not updated
+	UPROPERTY(EditAnywhere, Category = "Dynamic Geometry", meta = (EditCondition = "bDynamicGeometry", ClampMin = "0.0"))
+	float DynamicPositionTolerance = 1.0f;
+	// Rotation in degrees below which a moving geometry is not updated
+	UPROPERTY(EditAnywhere, Category = "Dynamic Geometry", meta = (EditCondition = "bDynamicGeometry", ClampMin = "0.0"))
+	float DynamicRotationTolerance = 1.0f;
+
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Mesh Baking Utilities")
 	void BakeMesh();
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Mesh Baking Utilities")
@@ -59,6 +75,17 @@ private:
 	UPROPERTY(VisibleAnywhere, Category = "Mesh Baking Utilities")
 	TArray<int32> BatchedBakedMeshIndicesBuffer;
 
+	//	Dynamic geometry vertices relative to this component, in Pico Spatial Audio coordinates
+	TArray<float> DynamicLocalVerticesBuffer;
+	FTransform SubmittedTransform;
+	double LastDynamicUpdateTime;
+
+	void OnTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags,
+	                        ETeleportType Teleport);
+	void PlaceDynamicVertices(const FTransform& ComponentTransform);
+	bool NeedsDynamicUpdate() const;
+	void UpdateDynamicGeometry();
+
 	void GatherStaticMeshes(TArray<UStaticMesh*>& OutGatheredStaticMeshes, TArray<FTransform>& OutGatheredStaticMeshTransforms,
 	                        bool InAllowCPUAccess);
 	
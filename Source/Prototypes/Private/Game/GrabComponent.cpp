@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Game/GrabComponent.h"
+#include "Game/GrabRegistry.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 
@@ -11,7 +12,8 @@ UGrabComponent::UGrabComponent()
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
 
-	// ...
+	// Moves are reported to the grab registry
+	bWantsOnUpdateTransform = true;
 }
 
 
@@ -25,6 +27,43 @@ void UGrabComponent::BeginPlay()
 	
 }
 
+void UGrabComponent::OnRegister()
+{
+	Super::OnRegister();
+	UWorld* World = GetWorld();
+	if(World && World->IsGameWorld())
+	{
+		if(UGrabRegistry* GrabRegistry = World->GetSubsystem<UGrabRegistry>())
+		{
+			GrabRegistry->Register(this);
+		}
+	}
+}
+
+void UGrabComponent::OnUnregister()
+{
+	if(UWorld* World = GetWorld())
+	{
+		if(UGrabRegistry* GrabRegistry = World->GetSubsystem<UGrabRegistry>())
+		{
+			GrabRegistry->Unregister(this);
+		}
+	}
+	Super::OnUnregister();
+}
+
+void UGrabComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+	if(UWorld* World = GetWorld())
+	{
+		if(UGrabRegistry* GrabRegistry = World->GetSubsystem<UGrabRegistry>())
+		{
+			GrabRegistry->UpdateLocation(this);
+		}
+	}
+}
+
 
 // Called every frame
 void UGrabComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
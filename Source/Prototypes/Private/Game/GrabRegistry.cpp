@@ -0,0 +1,86 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Game/GrabRegistry.h"
+#include "Game/GrabComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+
+// A few hand reaches wide, so a grab query only visits a handful of cells
+static const float GrabRegistryCellSize = 50.f;
+
+// Nearest candidates FindNearestInReach tests against the collision, one actor rarely carries more grab components
+static const int32 GrabRegistryMaxReachCandidates = 8;
+
+static bool IsPhysicsBodyWithinReach(const AActor* Actor, const FVector& Location, float Reach)
+{
+	TInlineComponentArray<UPrimitiveComponent*> Primitives(Actor);
+	for(const UPrimitiveComponent* Primitive : Primitives)
+	{
+		if(Primitive->GetCollisionObjectType() != ECC_PhysicsBody || !Primitive->IsCollisionEnabled())
+		{
+			continue;
+		}
+		FVector ClosestPoint;
+		const float Distance = Primitive->GetDistanceToCollision(Location, ClosestPoint);
+		if(Distance >= 0.f && Distance <= Reach)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+UGrabRegistry::UGrabRegistry()
+	: SpatialHash(GrabRegistryCellSize)
+{
+}
+
+void UGrabRegistry::Register(UGrabComponent* GrabComponent)
+{
+	SpatialHash.Update(GrabComponent, GrabComponent->GetComponentLocation());
+}
+
+void UGrabRegistry::Unregister(UGrabComponent* GrabComponent)
+{
+	SpatialHash.Remove(GrabComponent);
+}
+
+void UGrabRegistry::UpdateLocation(UGrabComponent* GrabComponent)
+{
+	if(SpatialHash.Contains(GrabComponent))
+	{
+		SpatialHash.Update(GrabComponent, GrabComponent->GetComponentLocation());
+	}
+}
+
+UGrabComponent* UGrabRegistry::FindNearest(const FVector& Location, float Radius) const
+{
+	UGrabComponent* Nearest = nullptr;
+	SpatialHash.FindNearest(Location, Radius, Nearest);
+	return Nearest;
+}
+
+UGrabComponent* UGrabRegistry::FindNearestInReach(const FVector& Location, float Radius, float Reach) const
+{
+	TArray<UGrabComponent*, TInlineAllocator<GrabRegistryMaxReachCandidates>> Candidates;
+	SpatialHash.FindKNearest(Location, GrabRegistryMaxReachCandidates, Radius, Candidates);
+	for(UGrabComponent* Candidate : Candidates)
+	{
+		if(Candidate->GetOwner() && IsPhysicsBodyWithinReach(Candidate->GetOwner(), Location, Reach))
+		{
+			return Candidate;
+		}
+	}
+	return nullptr;
+}
+
+void UGrabRegistry::FindKNearest(const FVector& Location, int32 Count, float Radius, TArray<UGrabComponent*>& OutGrabComponents) const
+{
+	SpatialHash.FindKNearest(Location, Count, Radius, OutGrabComponents);
+}
+
+void UGrabRegistry::FindWithinRadius(const FVector& Location, float Radius, TArray<UGrabComponent*>& OutGrabComponents) const
+{
+	OutGrabComponents.Reset();
+	SpatialHash.FindWithinRadius(Location, Radius, OutGrabComponents);
+}
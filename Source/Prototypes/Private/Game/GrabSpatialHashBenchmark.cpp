@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Game/PrototypesBenchmark.h"
+#include "Game/GrabSpatialHash.h"
+
+// Compares the grab spatial hash with testing every grabbable, on a synthetic sandbox level.
+// Every frame a share of the grabbables moves like thrown objects, then both hands query with the same radius as the pawns
+// and the hash must return the same candidates, in the same order, as testing every grabbable.
+
+namespace GrabSpatialHashBenchmark
+{
+	static const float LevelExtent = 2000.f;
+	static const float HandRadius = 30.f;
+	static const int32 HandCount = 5;
+
+	static void BruteForceKNearest(const TArray<FVector>& Locations, const FVector& Center, int32 Count, float Radius, TArray<int32>& OutIndices)
+	{
+		TArray<TPair<float, int32>> Candidates;
+		for (int32 Index = 0; Index < Locations.Num(); Index++)
+		{
+			const float DistanceSquared = FVector::DistSquared(Locations[Index], Center);
+			if (DistanceSquared <= Radius * Radius)
+			{
+				Candidates.Emplace(DistanceSquared, Index);
+			}
+		}
+		Candidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+		OutIndices.Reset();
+		for (int32 Index = 0; Index < FMath::Min(Count, Candidates.Num()); Index++)
+		{
+			OutIndices.Add(Candidates[Index].Value);
+		}
+	}
+
+	static void Execute(const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+	{
+		FPrototypesBenchmark Benchmark(TEXT("Prototypes.Grab.BenchmarkSpatialHash"), Args, Ar);
+		const int32 NumGrabbables = FMath::Max(Benchmark.Param(TEXT("Count="), 5000), 1);
+		const int32 NumFrames = FMath::Max(Benchmark.Param(TEXT("Frames="), 200), 1);
+		const float MovingShare = Benchmark.Param(TEXT("Moving="), 0.1f);
+		const int32 NumMoving = FMath::Clamp(FMath::RoundToInt(NumGrabbables * MovingShare), 0, NumGrabbables);
+
+		// Objects lie on a few floors of the level, a real sandbox level is not uniformly filled either
+		FRandomStream Random(0x47524142);
+		TArray<FVector> Locations;
+		Locations.Reserve(NumGrabbables);
+		for (int32 Index = 0; Index < NumGrabbables; Index++)
+		{
+			Locations.Add(FVector(Random.FRandRange(-LevelExtent, LevelExtent), Random.FRandRange(-LevelExtent, LevelExtent), Random.RandRange(0, 3) * 300.f + Random.FRandRange(0.f, 150.f)));
+		}
+
+		TGrabSpatialHash<int32> SpatialHash;
+		uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumGrabbables; Index++)
+		{
+			SpatialHash.Update(Index, Locations[Index]);
+		}
+		const uint64 BuildCycles = FPlatformTime::Cycles64() - StartCycles;
+
+		uint64 UpdateCycles = 0;
+		uint64 HashQueryCycles = 0;
+		uint64 BruteForceQueryCycles = 0;
+		int32 NumQueries = 0;
+		int32 Mismatches = 0;
+		int32 NumFound = 0;
+		TArray<int32> HashResults;
+		TArray<int32> BruteForceResults;
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			StartCycles = FPlatformTime::Cycles64();
+			for (int32 Moved = 0; Moved < NumMoving; Moved++)
+			{
+				const int32 Index = Random.RandHelper(NumGrabbables);
+				Locations[Index] += Random.GetUnitVector() * Random.FRandRange(0.f, 40.f);
+				SpatialHash.Update(Index, Locations[Index]);
+			}
+			UpdateCycles += FPlatformTime::Cycles64() - StartCycles;
+
+			// Hands are placed next to a grabbable so most queries have candidates
+			for (int32 Hand = 0; Hand < 2; Hand++)
+			{
+				const FVector HandLocation = Locations[Random.RandHelper(NumGrabbables)] + Random.GetUnitVector() * Random.FRandRange(0.f, HandRadius);
+
+				StartCycles = FPlatformTime::Cycles64();
+				SpatialHash.FindKNearest(HandLocation, HandCount, HandRadius, HashResults);
+				HashQueryCycles += FPlatformTime::Cycles64() - StartCycles;
+
+				StartCycles = FPlatformTime::Cycles64();
+				BruteForceKNearest(Locations, HandLocation, HandCount, HandRadius, BruteForceResults);
+				BruteForceQueryCycles += FPlatformTime::Cycles64() - StartCycles;
+
+				Mismatches += HashResults != BruteForceResults ? 1 : 0;
+				NumFound += HashResults.Num();
+				NumQueries++;
+			}
+		}
+
+		Ar.Logf(TEXT("Grab spatial hash benchmark: %d grabbables, %d frames, %d moving per frame, hash built in %.3f ms"), NumGrabbables, NumFrames, NumMoving, FPlatformTime::ToMilliseconds64(BuildCycles));
+		Benchmark.BeginTable(FPrototypesBenchmark::EUnit::Microseconds);
+		Benchmark.Row(TEXT("hash update per frame"), UpdateCycles, NumFrames);
+		Benchmark.Row(TEXT("hash query"), HashQueryCycles, NumQueries);
+		Benchmark.Row(TEXT("every grabbable query"), BruteForceQueryCycles, NumQueries);
+		Ar.Logf(TEXT("Queries: %d, average candidates: %.2f"), NumQueries, (float)NumFound / NumQueries);
+		Benchmark.Check(Mismatches == 0, TEXT("%d of %d queries returned other candidates than testing every grabbable"), Mismatches, NumQueries);
+		Benchmark.Finish();
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchmarkCommand(
+		TEXT("Prototypes.Grab.BenchmarkSpatialHash"),
+		TEXT("Moves synthetic grabbables and runs k-nearest hand queries through the grab spatial hash and by testing every grabbable, reports CPU time and fails on any mismatch.\n")
+		TEXT("Params: Count= Frames= Moving="),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Execute));
+}
+
+#endif
@@ -5,6 +5,7 @@
 #include "Components/InputComponent.h"
 #include "Camera/CameraComponent.h"
 #include "Game/GrabComponent.h"
+#include "Game/GrabRegistry.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/KismetMathLibrary.h"
@@ -222,7 +223,7 @@ void AVRCharacter::GripLeft()
 
 	UE_LOG(LogTemp, Warning, TEXT("GripLeft"));
 	//TryGrab(MotionControllerComponent_L, LeftHandSphere);
-	UGrabComponent* NearestGripComponent = GetNearestGripComponent(MotionControllerComponent_L, LeftHandSphere);
+	UGrabComponent* NearestGripComponent = GetNearestGripComponent(MotionControllerComponent_L);
 	if(NearestGripComponent)
 	{
 		AttachedElement = NearestGripComponent->GetOwner();
@@ -240,7 +241,7 @@ void AVRCharacter::GripRight()
 {
 	return;
 	UE_LOG(LogTemp, Warning, TEXT("GripRight"));
-	UGrabComponent* NearestGripComponent = GetNearestGripComponent(MotionControllerComponent_R, RightHandSphere);
+	UGrabComponent* NearestGripComponent = GetNearestGripComponent(MotionControllerComponent_R);
 	if(NearestGripComponent)
 	{
 		AttachedElement = NearestGripComponent->GetOwner();
@@ -331,40 +332,15 @@ void AVRCharacter::GripReleaseRight()
 // 	}
 // }
 
-UGrabComponent* AVRCharacter::GetNearestGripComponent(const UMotionControllerComponent* MotionControllerComponent, USphereComponent* Sphere)
+UGrabComponent* AVRCharacter::GetNearestGripComponent(const UMotionControllerComponent* MotionControllerComponent)
 {
-	FHitResult OutHit;
-	const TArray<AActor*> ActorsToIgnore;
-	//ActorsToIgnore.Add(GetOwner());
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypesArray;
-	ObjectTypesArray.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_PhysicsBody));
-	UKismetSystemLibrary::SphereTraceSingleForObjects(GetWorld(), MotionControllerComponent->K2_GetComponentLocation(), MotionControllerComponent->K2_GetComponentLocation(),
-		6.f, ObjectTypesArray, false, ActorsToIgnore, EDrawDebugTrace::None, OutHit, true, FLinearColor::Gray, FLinearColor::Blue, 1.0f);
-
-	UGrabComponent* LocalNearestGripComponent = nullptr;
-	if(OutHit.Actor == nullptr)
+	// The nearest grab component within GrabRadius of the controller wins, as long as the hand touches its actor
+	const UGrabRegistry* GrabRegistry = GetWorld()->GetSubsystem<UGrabRegistry>();
+	if(!GrabRegistry)
 	{
-		return LocalNearestGripComponent;
+		return nullptr;
 	}
-	TArray<UActorComponent*> Components = OutHit.Actor->K2_GetComponentsByClass(UGrabComponent::StaticClass());
-	
-	// if(Components.Num() > 0)
-	// {
-	for(auto Comp : Components)
-	{
-		if(Comp)
-		{
-			UGrabComponent* GripComponent = Cast<UGrabComponent>(Comp);
-			float VectorLengthSquared = UKismetMathLibrary::VSizeSquared(UKismetMathLibrary::Subtract_VectorVector(GripComponent->K2_GetComponentLocation(), MotionControllerComponent->K2_GetComponentLocation()));
-			if(VectorLengthSquared <= 9999999.0)
-			{
-				LocalNearestGripComponent = GripComponent;
-			}
-		}
-	}
-	//}
-	
-	return LocalNearestGripComponent;
+	return GrabRegistry->FindNearestInReach(MotionControllerComponent->GetComponentLocation(), GrabRadius, GrabReach);
 }
 
 FHitResult AVRCharacter::GetComponentInSight(USphereComponent* SphereComponentRef)
@@ -1,7 +1,6 @@
 #include "Player/VRPawn.h"
 #include "HeadMountedDisplayFunctionLibrary.h"
-#include "Kismet/KismetMathLibrary.h"
-#include "Kismet/KismetSystemLibrary.h"
+#include "Game/GrabRegistry.h"
 
 // Sets default values
 AVRPawn::AVRPawn()
@@ -80,7 +79,7 @@ int32 AVRPawn::GetScore() const { return Score; }
 
 void AVRPawn::GripLeft()
 {
-	UGrabComponent* NearestGripComponent = GetNearestGripComponent(MotionControllerComponent_L, LeftHandSphere);
+	UGrabComponent* NearestGripComponent = GetNearestGripComponent(MotionControllerComponent_L);
 	if(NearestGripComponent)
 	{
 		AttachedElement = NearestGripComponent->GetOwner();
@@ -99,7 +98,7 @@ void AVRPawn::GripLeft()
 void AVRPawn::GripRight()
 {
 	UE_LOG(LogTemp, Warning, TEXT("GripRight"));
-	UGrabComponent* NearestGripComponent = GetNearestGripComponent(MotionControllerComponent_R, RightHandSphere);
+	UGrabComponent* NearestGripComponent = GetNearestGripComponent(MotionControllerComponent_R);
 	if(NearestGripComponent)
 	{
 		AttachedElement = NearestGripComponent->GetOwner();
@@ -142,40 +141,14 @@ void AVRPawn::GripReleaseRight()
 	}
 }
 
-UGrabComponent* AVRPawn::GetNearestGripComponent(UMotionControllerComponent* MotionControllerComponent,
-	USphereComponent* Sphere)
+UGrabComponent* AVRPawn::GetNearestGripComponent(UMotionControllerComponent* MotionControllerComponent)
 {
-	FHitResult OutHit;
-	TArray<AActor*> ActorsToIgnore;
-	//ActorsToIgnore.Add(GetOwner());
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypesArray;
-	ObjectTypesArray.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_PhysicsBody));
-	UKismetSystemLibrary::SphereTraceSingleForObjects(GetWorld(), MotionControllerComponent->K2_GetComponentLocation(), MotionControllerComponent->K2_GetComponentLocation(),
-		6.f, ObjectTypesArray, false, ActorsToIgnore, EDrawDebugTrace::None, OutHit, true, FLinearColor::Gray, FLinearColor::Blue, 1.0f);
-
-	UGrabComponent* LocalNearestGripComponent = nullptr;
-	if(OutHit.Actor == nullptr)
+	// The nearest grab component within GrabRadius of the controller wins, as long as the hand touches its actor
+	const UGrabRegistry* GrabRegistry = GetWorld()->GetSubsystem<UGrabRegistry>();
+	if(!GrabRegistry)
 	{
-		return LocalNearestGripComponent;
+		return nullptr;
 	}
-	TArray<UActorComponent*> Components = OutHit.Actor->K2_GetComponentsByClass(UGrabComponent::StaticClass());
-	
-	// if(Components.Num() > 0)
-	// {
-	for(auto Comp : Components)
-	{
-		if(Comp)
-		{
-			UGrabComponent* GripComponent = Cast<UGrabComponent>(Comp);
-			float VectorLengthSquared = UKismetMathLibrary::VSizeSquared(UKismetMathLibrary::Subtract_VectorVector(GripComponent->K2_GetComponentLocation(), MotionControllerComponent->K2_GetComponentLocation()));
-			if(VectorLengthSquared <= 9999999.0)
-			{
-				LocalNearestGripComponent = GripComponent;
-			}
-		}
-	}
-	//}
-	
-	return LocalNearestGripComponent;
+	return GrabRegistry->FindNearestInReach(MotionControllerComponent->GetComponentLocation(), GrabRadius, GrabReach);
 }
 
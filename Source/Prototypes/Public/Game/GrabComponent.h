@@ -30,6 +30,11 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	// Keep the world's grab registry in sync with this component
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+
 	UPROPERTY()
 	FRotator PrimaryGrabRelativeRotation;
 
@@ -0,0 +1,52 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Game/GrabSpatialHash.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GrabRegistry.generated.h"
+
+class UGrabComponent;
+
+/**
+ * Every UGrabComponent of a world, kept in a spatial hash so the hands find grab candidates without tracing the scene.
+ * Grab components register themselves and report when they move.
+ */
+UCLASS()
+class PROTOTYPES_API UGrabRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UGrabRegistry();
+
+	void Register(UGrabComponent* GrabComponent);
+	void Unregister(UGrabComponent* GrabComponent);
+	void UpdateLocation(UGrabComponent* GrabComponent);
+
+	/** Nearest grab component within Radius of Location, null if there is none */
+	UFUNCTION(BlueprintCallable)
+	UGrabComponent* FindNearest(const FVector& Location, float Radius) const;
+
+	/**
+	 * Nearest grab component within Radius of Location whose actor has a physics body within Reach of Location, null if
+	 * there is none. Grab components sit anywhere on their actor, so the reach is measured to its collision
+	 */
+	UFUNCTION(BlueprintCallable)
+	UGrabComponent* FindNearestInReach(const FVector& Location, float Radius, float Reach) const;
+
+	/** Up to Count grab components within Radius of Location, nearest first */
+	UFUNCTION(BlueprintCallable)
+	void FindKNearest(const FVector& Location, int32 Count, float Radius, TArray<UGrabComponent*>& OutGrabComponents) const;
+
+	/** Grab components within Radius of Location, in no particular order */
+	UFUNCTION(BlueprintCallable)
+	void FindWithinRadius(const FVector& Location, float Radius, TArray<UGrabComponent*>& OutGrabComponents) const;
+
+	int32 Num() const { return SpatialHash.Num(); }
+
+private:
+	/** Grab components unregister before they are destroyed, so the hash never holds a stale pointer */
+	TGrabSpatialHash<UGrabComponent*> SpatialHash;
+};
@@ -0,0 +1,193 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform spatial hash of points, used to find grabbables near a hand.
+ * Each element sits in the cell its location falls in; moving an element only touches the cells when it crosses into another one.
+ * Queries write into an array owned by the caller, so a reused array does not allocate.
+ */
+template<typename ElementType>
+class TGrabSpatialHash
+{
+public:
+	explicit TGrabSpatialHash(float InCellSize = 50.f)
+		: InvCellSize(1.f / InCellSize)
+	{
+	}
+
+	int32 Num() const { return ElementCells.Num(); }
+
+	bool Contains(ElementType Element) const { return ElementCells.Contains(Element); }
+
+	/** Adds the element, or moves it if it is already in the hash */
+	void Update(ElementType Element, const FVector& Location)
+	{
+		const FIntVector NewCell = GetCell(Location);
+		FIntVector* CurrentCell = ElementCells.Find(Element);
+		if (CurrentCell && *CurrentCell == NewCell)
+		{
+			for (FCellEntry& Entry : Cells.FindChecked(NewCell))
+			{
+				if (Entry.Element == Element)
+				{
+					Entry.Location = Location;
+					return;
+				}
+			}
+			checkNoEntry();
+		}
+		if (CurrentCell)
+		{
+			RemoveFromCell(Element, *CurrentCell);
+			*CurrentCell = NewCell;
+		}
+		else
+		{
+			ElementCells.Add(Element, NewCell);
+		}
+		Cells.FindOrAdd(NewCell).Add({ Element, Location });
+	}
+
+	void Remove(ElementType Element)
+	{
+		FIntVector Cell;
+		if (ElementCells.RemoveAndCopyValue(Element, Cell))
+		{
+			RemoveFromCell(Element, Cell);
+		}
+	}
+
+	void Reset()
+	{
+		Cells.Reset();
+		ElementCells.Reset();
+	}
+
+	/** Appends the elements within Radius of Center, in no particular order */
+	template<typename AllocatorType>
+	void FindWithinRadius(const FVector& Center, float Radius, TArray<ElementType, AllocatorType>& OutElements) const
+	{
+		ForEachWithinRadius(Center, Radius, [&OutElements](const FCellEntry& Entry, float)
+		{
+			OutElements.Add(Entry.Element);
+		});
+	}
+
+	/** Replaces the contents of OutElements with up to Count elements within Radius of Center, nearest first */
+	template<typename AllocatorType>
+	void FindKNearest(const FVector& Center, int32 Count, float Radius, TArray<ElementType, AllocatorType>& OutElements) const
+	{
+		OutElements.Reset();
+		if (Count <= 0)
+		{
+			return;
+		}
+		TArray<TPair<float, ElementType>, TInlineAllocator<64>> Candidates;
+		ForEachWithinRadius(Center, Radius, [&Candidates](const FCellEntry& Entry, float DistanceSquared)
+		{
+			Candidates.Emplace(DistanceSquared, Entry.Element);
+		});
+		Candidates.Sort([](const TPair<float, ElementType>& A, const TPair<float, ElementType>& B)
+		{
+			return A.Key < B.Key;
+		});
+		for (int32 Index = 0; Index < FMath::Min(Count, Candidates.Num()); Index++)
+		{
+			OutElements.Add(Candidates[Index].Value);
+		}
+	}
+
+	/** Nearest element within Radius of Center */
+	bool FindNearest(const FVector& Center, float Radius, ElementType& OutElement) const
+	{
+		float BestDistanceSquared = MAX_flt;
+		bool bFound = false;
+		ForEachWithinRadius(Center, Radius, [&](const FCellEntry& Entry, float DistanceSquared)
+		{
+			if (DistanceSquared < BestDistanceSquared)
+			{
+				BestDistanceSquared = DistanceSquared;
+				OutElement = Entry.Element;
+				bFound = true;
+			}
+		});
+		return bFound;
+	}
+
+private:
+	struct FCellEntry
+	{
+		ElementType Element;
+		FVector Location;
+	};
+
+	FIntVector GetCell(const FVector& Location) const
+	{
+		return FIntVector(
+			FMath::FloorToInt(Location.X * InvCellSize),
+			FMath::FloorToInt(Location.Y * InvCellSize),
+			FMath::FloorToInt(Location.Z * InvCellSize));
+	}
+
+	void RemoveFromCell(ElementType Element, const FIntVector& Cell)
+	{
+		TArray<FCellEntry>& Entries = Cells.FindChecked(Cell);
+		Entries.RemoveAllSwap([Element](const FCellEntry& Entry) { return Entry.Element == Element; });
+		// Objects that keep moving would otherwise leave a trail of empty cells behind
+		if (Entries.Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+
+	template<typename FuncType>
+	void ForEachWithinRadius(const FVector& Center, float Radius, FuncType&& Func) const
+	{
+		const float RadiusSquared = Radius * Radius;
+		const FIntVector MinCell = GetCell(Center - FVector(Radius));
+		const FIntVector MaxCell = GetCell(Center + FVector(Radius));
+		const int64 NumCellsInBounds = (int64)(MaxCell.X - MinCell.X + 1) * (MaxCell.Y - MinCell.Y + 1) * (MaxCell.Z - MinCell.Z + 1);
+
+		auto VisitCell = [&](const TArray<FCellEntry>& Entries)
+		{
+			for (const FCellEntry& Entry : Entries)
+			{
+				const float DistanceSquared = FVector::DistSquared(Entry.Location, Center);
+				if (DistanceSquared <= RadiusSquared)
+				{
+					Func(Entry, DistanceSquared);
+				}
+			}
+		};
+
+		// A large radius covers more cells than are occupied, walk the occupied ones instead
+		if (NumCellsInBounds > Cells.Num())
+		{
+			for (const TPair<FIntVector, TArray<FCellEntry>>& Cell : Cells)
+			{
+				VisitCell(Cell.Value);
+			}
+			return;
+		}
+		for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+				{
+					if (const TArray<FCellEntry>* Entries = Cells.Find(FIntVector(X, Y, Z)))
+					{
+						VisitCell(*Entries);
+					}
+				}
+			}
+		}
+	}
+
+	float InvCellSize;
+	TMap<FIntVector, TArray<FCellEntry>> Cells;
+	TMap<ElementType, FIntVector> ElementCells;
+};
@@ -54,6 +54,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	USphereComponent* LeftHandSphere;
 
+	/** How far from the motion controller grab components are considered, in cm */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float GrabRadius = 30.f;
+
+	/** How close the motion controller must be to the physics body of a grab component's actor to pick it up, in cm */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float GrabReach = 6.f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	UPhysicsHandleComponent *PhysicsHandleComponent = nullptr;
 	
@@ -147,7 +155,7 @@ protected:
 	void GripReleaseLeft();
 	void GripReleaseRight();
 	// void TryGrab(UMotionControllerComponent* MotionControllerComponent, USphereComponent* Sphere);
-	UGrabComponent* GetNearestGripComponent(const UMotionControllerComponent* MotionControllerComponent, USphereComponent* Sphere);
+	UGrabComponent* GetNearestGripComponent(const UMotionControllerComponent* MotionControllerComponent);
 
 	FHitResult GetComponentInSight(USphereComponent* SphereComponentRef);
 	
@@ -49,6 +49,14 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	USphereComponent* LeftHandSphere;
+
+	/** How far from the motion controller grab components are considered, in cm */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float GrabRadius = 30.f;
+
+	/** How close the motion controller must be to the physics body of a grab component's actor to pick it up, in cm */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float GrabReach = 6.f;
 	
 	/** Referência do ator que está sendo segurado pelo controlador **/
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
@@ -65,7 +73,7 @@ protected:
 	void GripReleaseLeft();
 	void GripReleaseRight();
 
-	UGrabComponent* GetNearestGripComponent(UMotionControllerComponent* MotionControllerComponent, USphereComponent* Sphere);
+	UGrabComponent* GetNearestGripComponent(UMotionControllerComponent* MotionControllerComponent);
 	
 	UPROPERTY()
 	UGrabComponent* HeldComponentLeft;